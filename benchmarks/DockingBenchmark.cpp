@@ -0,0 +1,534 @@
+//============================================================================
+/// \file   DockingBenchmark.cpp
+/// \author Uwe Kindler
+/// \date   19.10.2026
+/// \brief  QtTest benchmarks for the advanced docking system
+//============================================================================
+
+
+//============================================================================
+//                                   INCLUDES
+//============================================================================
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <QApplication>
+#include <QCursor>
+#include <QLabel>
+#include <QMainWindow>
+#include <QMenu>
+#include <QThread>
+#include <QtTest>
+
+#include "DockManager.h"
+#include "DockWidget.h"
+#include "DockAreaWidget.h"
+#include "DockAreaTitleBar.h"
+#include "DockAreaTabBar.h"
+#include "FloatingDockContainer.h"
+#include "DockSplitter.h"
+#include "DockFrameTimeObserver.h"
+#include "DockLayoutModel.h"
+#include "DockLayoutSnapshot.h"
+#include "../demo/SyntheticLayout.h"
+
+using namespace ads;
+
+/**
+ * Bytes allocated via operator new while AllocationCountingEnabled is set.
+ * Used by the footprint benchmark to report real heap allocations.
+ */
+static std::atomic<bool> AllocationCountingEnabled(false);
+static std::atomic<qint64> AllocatedBytes(0);
+
+void* operator new(std::size_t Size)
+{
+	if (AllocationCountingEnabled)
+	{
+		AllocatedBytes += qint64(Size);
+	}
+	void* Ptr = std::malloc(Size ? Size : 1);
+	if (!Ptr)
+	{
+		throw std::bad_alloc();
+	}
+	return Ptr;
+}
+
+void* operator new[](std::size_t Size)
+{
+	return operator new(Size);
+}
+
+void operator delete(void* Ptr) noexcept
+{
+	std::free(Ptr);
+}
+
+void operator delete[](void* Ptr) noexcept
+{
+	std::free(Ptr);
+}
+
+void operator delete(void* Ptr, std::size_t) noexcept
+{
+	std::free(Ptr);
+}
+
+void operator delete[](void* Ptr, std::size_t) noexcept
+{
+	std::free(Ptr);
+}
+
+/**
+ * Content widget with a known paint time for the frame time tests
+ */
+class CSlowPaintWidget : public QLabel
+{
+public:
+	static const int PaintMsecs = 20;
+	using QLabel::QLabel;
+
+protected:
+	virtual void paintEvent(QPaintEvent* event) override
+	{
+		QThread::msleep(PaintMsecs);
+		QLabel::paintEvent(event);
+	}
+};
+
+/**
+ * Benchmarks for the performance critical operations of the docking system.
+ * All benchmarks run on the offscreen platform, so they do not need a
+ * display. Use the QtTest output options to get machine readable results,
+ * e.g. ads_benchmarks -o results.xml,xml or ads_benchmarks -o results.csv,csv
+ */
+class CDockingBenchmark : public QObject
+{
+	Q_OBJECT
+private:
+	QMainWindow* MainWindow = nullptr;
+	CDockManager* DockManager = nullptr;
+
+	/**
+	 * Creates the main window with a dock manager
+	 */
+	void createDockManager()
+	{
+		MainWindow = new QMainWindow();
+		MainWindow->resize(1280, 800);
+		DockManager = new CDockManager(MainWindow);
+		MainWindow->show();
+	}
+
+	/**
+	 * Deletes the main window and the dock manager
+	 */
+	void deleteDockManager()
+	{
+		delete MainWindow;
+		MainWindow = nullptr;
+		DockManager = nullptr;
+	}
+
+	/**
+	 * Adds Count dock widgets in the synthetic reference layout to the
+	 * dock manager
+	 */
+	static void createLayout(CDockManager* DockManager, int Count)
+	{
+		CSyntheticLayout::build(DockManager,
+			CSyntheticLayout::createDockWidgets(Count, "Benchmark"));
+	}
+
+	/**
+	 * Adds the dock widget counts of the data driven benchmarks
+	 */
+	static void addCountData()
+	{
+		QTest::addColumn<int>("Count");
+		QTest::newRow("10") << 10;
+		QTest::newRow("100") << 100;
+		QTest::newRow("1000") << 1000;
+	}
+
+private slots:
+	/**
+	 * Runs after each test function, also if it failed, and restores the
+	 * global state that a test may have changed
+	 */
+	void cleanup()
+	{
+		AllocationCountingEnabled = false;
+		CDockManager::setConfigFlag(CDockManager::LeanDockWidgets, false);
+		deleteDockManager();
+	}
+
+	void buildLayout_data()
+	{
+		addCountData();
+	}
+
+	/**
+	 * Builds a complete layout via CDockManager::addDockWidget()
+	 */
+	void buildLayout()
+	{
+		QFETCH(int, Count);
+		QBENCHMARK
+		{
+			createDockManager();
+			createLayout(DockManager, Count);
+			deleteDockManager();
+		}
+	}
+
+	void saveRestoreState_data()
+	{
+		addCountData();
+	}
+
+	/**
+	 * Saves the state and restores it again
+	 */
+	void saveRestoreState()
+	{
+		QFETCH(int, Count);
+		createDockManager();
+		createLayout(DockManager, Count);
+		QBENCHMARK
+		{
+			auto State = DockManager->saveState();
+			QVERIFY(DockManager->restoreState(State));
+		}
+		deleteDockManager();
+	}
+
+	void openPerspective_data()
+	{
+		addCountData();
+	}
+
+	/**
+	 * Switches between a perspective with all dock widgets open and a
+	 * perspective with every second dock widget closed
+	 */
+	void openPerspective()
+	{
+		QFETCH(int, Count);
+		createDockManager();
+		createLayout(DockManager, Count);
+		DockManager->addPerspective("AllOpen");
+		auto DockWidgets = DockManager->dockWidgetsMap().values();
+		for (int i = 0; i < DockWidgets.count(); i += 2)
+		{
+			DockWidgets[i]->toggleView(false);
+		}
+		DockManager->addPerspective("HalfClosed");
+		QBENCHMARK
+		{
+			DockManager->openPerspective("AllOpen");
+			DockManager->openPerspective("HalfClosed");
+		}
+		deleteDockManager();
+	}
+
+	void tabSwitching_data()
+	{
+		addCountData();
+	}
+
+	/**
+	 * Activates each tab of a dock area with Count tabs once
+	 */
+	void tabSwitching()
+	{
+		QFETCH(int, Count);
+		createDockManager();
+		CDockAreaWidget* DockArea = nullptr;
+		for (int i = 0; i < Count; ++i)
+		{
+			auto DockWidget = new CDockWidget(QString("Tab %1").arg(i));
+			DockWidget->setWidget(new QLabel(DockWidget->windowTitle()));
+			DockArea = DockManager->addDockWidget(CenterDockWidgetArea,
+				DockWidget, DockArea);
+		}
+
+		auto TabBar = DockArea->titleBar()->tabBar();
+		QBENCHMARK
+		{
+			for (int i = 0; i < TabBar->count(); ++i)
+			{
+				TabBar->setCurrentIndex(i);
+			}
+		}
+		deleteDockManager();
+	}
+
+	void dragFloatingWidget_data()
+	{
+		addCountData();
+	}
+
+	/**
+	 * Moves a floating widget along scripted cursor positions over the
+	 * dock manager. Each move updates the drop overlays.
+	 */
+	void dragFloatingWidget()
+	{
+		QFETCH(int, Count);
+		createDockManager();
+		createLayout(DockManager, Count);
+		auto DockWidget = DockManager->findDockWidget("Benchmark 0");
+		IFloatingWidget* Floating = DockManager->addDockWidgetFloating(DockWidget);
+
+		QVector<QPoint> CursorPositions;
+		QRect Rect = DockManager->rect();
+		for (int y = 1; y < 8; ++y)
+		{
+			for (int x = 1; x < 8; ++x)
+			{
+				CursorPositions.append(DockManager->mapToGlobal(QPoint(
+					Rect.width() * x / 8, Rect.height() * y / 8)));
+			}
+		}
+
+		Floating->startFloating(QPoint(10, 10), QSize(320, 240),
+			DraggingFloatingWidget, nullptr);
+		QBENCHMARK
+		{
+			for (const auto& Pos : CursorPositions)
+			{
+				QCursor::setPos(Pos);
+				Floating->moveFloating();
+			}
+		}
+		deleteDockManager();
+	}
+
+	void dockWidgetFootprint_data()
+	{
+		QTest::addColumn<bool>("Lean");
+		QTest::newRow("eager") << false;
+		QTest::newRow("lean") << true;
+	}
+
+	/**
+	 * Reports the bytes allocated with operator new per dock widget that has
+	 * never been added to a dock manager, with and without
+	 * CDockManager::LeanDockWidgets. The allocations of the content label
+	 * are included. Allocations that Qt does with malloc(), e.g. string
+	 * data, are not counted. The private data bytes and object counts of
+	 * CDockWidget::footprint() are printed as additional information.
+	 */
+	void dockWidgetFootprint()
+	{
+		static const int Count = 100;
+		QFETCH(bool, Lean);
+		CDockManager::setConfigFlag(CDockManager::LeanDockWidgets, Lean);
+		QList<CDockWidget*> DockWidgets;
+		DockWidgets.reserve(Count);
+		AllocatedBytes = 0;
+		AllocationCountingEnabled = true;
+		for (int i = 0; i < Count; ++i)
+		{
+			auto DockWidget = new CDockWidget(QString("Footprint %1").arg(i));
+			DockWidget->setWidget(new QLabel(DockWidget->windowTitle()));
+			DockWidgets.append(DockWidget);
+		}
+		AllocationCountingEnabled = false;
+
+		CDockWidgetFootprint Footprint;
+		for (auto DockWidget : DockWidgets)
+		{
+			Footprint += DockWidget->footprint();
+		}
+		qDeleteAll(DockWidgets);
+
+		qInfo("%s: %lld bytes allocated, %d private data bytes, %d objects, "
+			"%d widgets per dock widget", QTest::currentDataTag(),
+			AllocatedBytes / Count, Footprint.PrivateDataBytes / Count,
+			Footprint.ObjectCount / Count, Footprint.WidgetCount / Count);
+		QTest::setBenchmarkResult(qreal(AllocatedBytes) / Count,
+			QTest::BytesAllocated);
+	}
+
+	/**
+	 * Closes tabs of lean dock widgets whose toggle view action has never
+	 * been created. This must not crash.
+	 */
+	void closeTabLeanMode()
+	{
+		CDockManager::setConfigFlag(CDockManager::LeanDockWidgets, true);
+		createDockManager();
+		auto DockWidget1 = new CDockWidget("Lean 1");
+		DockWidget1->setWidget(new QLabel(DockWidget1->windowTitle()));
+		auto DockWidget2 = new CDockWidget("Lean 2");
+		DockWidget2->setWidget(new QLabel(DockWidget2->windowTitle()));
+		auto DockArea = DockManager->addDockWidget(CenterDockWidgetArea, DockWidget1);
+		DockManager->addDockWidget(CenterDockWidgetArea, DockWidget2, DockArea);
+
+		emit DockWidget1->tabWidget()->closeRequested();
+		QVERIFY(DockWidget1->isClosed());
+		DockWidget2->toggleView(false);
+		QVERIFY(DockWidget2->isClosed());
+		DockWidget2->toggleView(true);
+		QVERIFY(!DockWidget2->isClosed());
+		// cleanup() deletes the dock manager and resets the config flag
+	}
+
+	/**
+	 * A recycled dock widget emits closed() to the receivers of its user
+	 * and leaves the view menu before it is reset for reuse
+	 */
+	void recycleDockWidget()
+	{
+		createDockManager();
+		DockManager->setDockWidgetPoolSize(1);
+		auto DockWidget = DockManager->createDockWidget("Recycled");
+		DockWidget->setWidget(new QLabel(DockWidget->windowTitle()));
+		DockWidget->setFeature(CDockWidget::DockWidgetDeleteOnClose, true);
+		DockManager->addDockWidget(CenterDockWidgetArea, DockWidget);
+		auto ToggleViewAction = DockWidget->toggleViewAction();
+		DockManager->addToggleViewActionToMenu(ToggleViewAction);
+		int ClosedCount = 0;
+		connect(DockWidget, &CDockWidget::closed, [&ClosedCount]() {ClosedCount++;});
+
+		DockWidget->closeDockWidget();
+		QCOMPARE(ClosedCount, 1);
+		QVERIFY(!DockManager->viewMenu()->actions().contains(ToggleViewAction));
+		QCoreApplication::processEvents();
+		QVERIFY(!DockWidget->widget());
+
+		auto ReusedDockWidget = DockManager->createDockWidget("Reused");
+		QCOMPARE(ReusedDockWidget, DockWidget);
+		ReusedDockWidget->closeDockWidget();
+		QCOMPARE(ClosedCount, 1);
+		deleteDockManager();
+	}
+
+	/**
+	 * Closing other tabs in one batch updates the layout model and the
+	 * layout snapshot, even if the current tab of the area does not change
+	 */
+	void batchCloseUpdatesLayoutModel()
+	{
+		createDockManager();
+		auto DockWidgets = CSyntheticLayout::createDockWidgets(3, "Tab");
+		auto DockArea = DockManager->addDockWidget(CenterDockWidgetArea, DockWidgets[0]);
+		DockManager->addDockWidget(CenterDockWidgetArea, DockWidgets[1], DockArea);
+		DockManager->addDockWidget(CenterDockWidgetArea, DockWidgets[2], DockArea);
+		DockArea->setCurrentDockWidget(DockWidgets[0]);
+		QVERIFY(!DockManager->layoutModel().isDockWidgetClosed("Tab 1"));
+
+		DockManager->closeDockWidgets({DockWidgets[1], DockWidgets[2]});
+		QCOMPARE(DockArea->currentDockWidget(), DockWidgets[0]);
+		QVERIFY(!DockManager->layoutModel().isDockWidgetClosed("Tab 0"));
+		QVERIFY(DockManager->layoutModel().isDockWidgetClosed("Tab 1"));
+		QVERIFY(DockManager->layoutModel().isDockWidgetClosed("Tab 2"));
+		auto Snapshot = DockManager->snapshotLayout();
+		QCOMPARE(Snapshot.Containers[0].Areas.count(), 1);
+		QCOMPARE(Snapshot.Containers[0].Areas[0].OpenFlags, QList<bool>({true, false, false}));
+		deleteDockManager();
+	}
+
+	/**
+	 * Closing and deleting dock widgets in one batch deletes their dock
+	 * areas. The layout model must not return the deleted areas.
+	 */
+	void batchCloseDeletesLayoutModelAreas()
+	{
+		createDockManager();
+		auto DockWidgets = CSyntheticLayout::createDockWidgets(2, "Area");
+		DockWidgets[0]->setFeature(CDockWidget::DockWidgetDeleteOnClose, true);
+		auto DockArea = DockManager->addDockWidget(LeftDockWidgetArea, DockWidgets[0]);
+		auto KeptDockArea = DockManager->addDockWidget(RightDockWidgetArea, DockWidgets[1]);
+		QVERIFY(QTest::qWaitForWindowExposed(MainWindow));
+		QPoint Pos = DockArea->mapToGlobal(DockArea->rect().center());
+		QCOMPARE(DockManager->dockAreaAt(Pos), DockArea);
+
+		DockManager->closeDockWidgets({DockWidgets[0]});
+		QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+		QCoreApplication::processEvents();
+		QCOMPARE(DockManager->layoutModel().areaCount(), 1);
+		QCOMPARE(DockManager->dockAreaAt(KeptDockArea->mapToGlobal(
+			KeptDockArea->rect().center())), KeptDockArea);
+		auto DockAreaAtPos = DockManager->dockAreaAt(Pos);
+		QVERIFY(!DockAreaAtPos || DockAreaAtPos == KeptDockArea);
+		deleteDockManager();
+	}
+
+	/**
+	 * The frame times of the frame time observer contain the time needed
+	 * to paint the affected widgets
+	 */
+	void frameTimeIncludesPaint()
+	{
+		createDockManager();
+		auto SlowWidget = new CSlowPaintWidget("Slow");
+		auto DockWidget1 = new CDockWidget("Slow");
+		DockWidget1->setWidget(SlowWidget);
+		auto DockWidget2 = new CDockWidget("Fast");
+		DockWidget2->setWidget(new QLabel(DockWidget2->windowTitle()));
+		DockManager->addDockWidget(LeftDockWidgetArea, DockWidget1);
+		DockManager->addDockWidget(RightDockWidgetArea, DockWidget2);
+		QVERIFY(QTest::qWaitForWindowExposed(MainWindow));
+
+		auto Observer = DockManager->frameTimeObserver();
+		Observer->setEnabled(true);
+		CDockInteractionFrameTimes Result;
+		bool Finished = false;
+		connect(Observer, &CDockFrameTimeObserver::interactionFinished,
+			[&](const CDockInteractionFrameTimes& FrameTimes)
+			{
+				Result = FrameTimes;
+				Finished = true;
+			});
+
+		// Each input event repaints the slow widget
+		auto Handle = DockManager->findChild<CDockSplitter*>()->handle(1);
+		QPoint Pos = Handle->rect().center();
+		auto sendMouseEvent = [&](QEvent::Type Type, Qt::MouseButtons Buttons)
+		{
+			QMouseEvent Event(Type, Pos, Handle->mapToGlobal(Pos), Qt::LeftButton,
+				Buttons, Qt::NoModifier);
+			QApplication::sendEvent(Handle, &Event);
+			SlowWidget->update();
+			QCoreApplication::processEvents();
+		};
+		sendMouseEvent(QEvent::MouseButtonPress, Qt::LeftButton);
+		for (int i = 0; i < 3; ++i)
+		{
+			Pos += QPoint(1, 0);
+			sendMouseEvent(QEvent::MouseMove, Qt::LeftButton);
+		}
+		sendMouseEvent(QEvent::MouseButtonRelease, Qt::NoButton);
+		QTRY_VERIFY(Finished);
+		Observer->setEnabled(false);
+
+		QCOMPARE(Result.Interaction, SplitterDragInteraction);
+		QVERIFY(Result.FrameCount >= 1);
+		QVERIFY(Result.MedianNsecs >= qint64(CSlowPaintWidget::PaintMsecs) * 1000000);
+		deleteDockManager();
+	}
+};
+
+
+//============================================================================
+int main(int argc, char *argv[])
+{
+	// The benchmarks do not need a display
+	if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+	{
+		qputenv("QT_QPA_PLATFORM", "offscreen");
+	}
+	QApplication App(argc, argv);
+	CDockingBenchmark Benchmark;
+	return QTest::qExec(&Benchmark, argc, argv);
+}
+
+#include "DockingBenchmark.moc"
+
+//---------------------------------------------------------------------------
+// EOF DockingBenchmark.cpp
@@ -75,6 +75,7 @@
 #include "FloatingDockContainer.h"
 #include "DockComponentsFactory.h"
 #include "StatusDialog.h"
+#include "StartupProfile.h"
 
 
 
@@ -348,6 +349,9 @@ struct MainWindowPrivate
 //============================================================================
 void MainWindowPrivate::createContent()
 {
+	// Setup the whole initial layout in one layout change transaction
+	ads::CDockLayoutChangeGuard LayoutChangeGuard(DockManager);
+
 	// Test container docking
 	QMenu* ViewMenu = ui.menuView;
 	auto DockWidget = createCalendarDockWidget(ViewMenu);
@@ -479,6 +483,14 @@ void MainWindowPrivate::createActions()
 	ui.menuTests->addSeparator();
 	a = ui.menuTests->addAction("Show Status Dialog");
 	_this->connect(a, SIGNAL(triggered()), SLOT(showStatusDialog()));
+	a = ui.menuTests->addAction("Quick Switch Dock Widget...");
+	a->setShortcut(QKeySequence("Ctrl+K"));
+	// The dock manager is created after the actions, so we cannot connect
+	// to its slot directly here
+	QObject::connect(a, &QAction::triggered, [this]()
+	{
+		DockManager->showQuickSwitcher();
+	});
 	ui.menuTests->addSeparator();
 }
 
@@ -525,6 +537,13 @@ void MainWindowPrivate::restorePerspectives()
 
 //============================================================================
 CMainWindow::CMainWindow(QWidget *parent) :
+	CMainWindow(nullptr, parent)
+{
+}
+
+
+//============================================================================
+CMainWindow::CMainWindow(CStartupProfile* StartupProfile, QWidget *parent) :
 	QMainWindow(parent),
 	d(new MainWindowPrivate(this))
 {
@@ -572,12 +591,32 @@ CMainWindow::CMainWindow(QWidget *parent) :
 	// CDockManager::setConfigFlag(CDockManager::HideSingleCentralWidgetTitleBar, true);
 
 	// Now create the dock manager and its content
+	if (StartupProfile)
+	{
+		StartupProfile->endPhase("Main window setup");
+	}
 	d->DockManager = new CDockManager(this);
+	if (StartupProfile)
+	{
+		StartupProfile->endPhase("Dock manager construction");
+	}
 
 	connect(d->PerspectiveComboBox, SIGNAL(activated(const QString&)),
 		d->DockManager, SLOT(openPerspective(const QString&)));
 
-	d->createContent();
+	// The synthetic layout replaces the demo content
+	if (StartupProfile && StartupProfile->hasSyntheticLayout())
+	{
+		StartupProfile->buildLayout(d->DockManager, StartupProfile->createDockWidgets());
+	}
+	else
+	{
+		d->createContent();
+		if (StartupProfile)
+		{
+			StartupProfile->endPhase("Demo content creation");
+		}
+	}
 	// Default window geometry - center on screen
     resize(1280, 720);
     setGeometry(QStyle::alignedRect(
@@ -587,6 +626,11 @@ CMainWindow::CMainWindow(QWidget *parent) :
 
 	//d->restoreState();
 	d->restorePerspectives();
+	if (StartupProfile)
+	{
+		StartupProfile->profileRestoreState(d->DockManager);
+		StartupProfile->profileFirstPaint(d->DockManager);
+	}
 }
 
 
@@ -35,6 +35,7 @@
 
 
 struct MainWindowPrivate;
+class CStartupProfile;
 
 
 /**
@@ -52,6 +53,12 @@ protected:
 
 public:
 	explicit CMainWindow(QWidget *parent = 0);
+
+	/**
+	 * Creates the main window. The startup phases are recorded in the
+	 * given startup profile.
+	 */
+	explicit CMainWindow(CStartupProfile* StartupProfile, QWidget *parent = 0);
 	virtual ~CMainWindow();
 
 private slots:
@@ -0,0 +1,237 @@
+#ifndef StartupProfileH
+#define StartupProfileH
+/*******************************************************************************
+** Qt Advanced Docking System
+** Copyright (C) 2017 Uwe Kindler
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 2.1 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+
+//============================================================================
+/// \file   StartupProfile.h
+/// \author Uwe Kindler
+/// \date   19.10.2026
+/// \brief  Startup profiling and synthetic layouts for the demo and examples
+//============================================================================
+
+
+//============================================================================
+//                                   INCLUDES
+//============================================================================
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QList>
+#include <QPair>
+#include <QStringList>
+#include <QTextStream>
+#include <QTimer>
+#include <QWidget>
+
+#include "DockManager.h"
+#include "DockWidget.h"
+#include "SyntheticLayout.h"
+
+
+/**
+ * Measures the startup phases of an application that uses the docking
+ * system and optionally creates a synthetic layout with many dock widgets.
+ * The following command line options are supported:
+ * - --profile-startup prints the time of each startup phase after the
+ *   first paint of the dock manager
+ * - --widgets N creates N synthetic dock widgets instead of the normal
+ *   application content
+ * - --floating M puts M of the synthetic dock widgets into floating
+ *   containers
+ *
+ * The synthetic layout is built by CSyntheticLayout, so it is the same
+ * reference workload as in the benchmarks and the stress test, i.e.:
+ * \code
+ * AdvancedDockingSystemDemo --profile-startup --widgets 500 --floating 10
+ * \endcode
+ */
+class CStartupProfile : public QObject
+{
+private:
+	QElapsedTimer Timer;
+	QElapsedTimer PhaseTimer;
+	QList<QPair<QString, qint64>> Phases;
+	QWidget* FirstPaintWidget = nullptr;
+
+	/**
+	 * Returns the integer value of the given option or 0 if the option is
+	 * not given
+	 */
+	static int intOption(const QStringList& Arguments, const QString& Option)
+	{
+		int Index = Arguments.indexOf(Option);
+		return (Index >= 0 && Index + 1 < Arguments.count())
+			? qMax(0, Arguments[Index + 1].toInt()) : 0;
+	}
+
+protected:
+	/**
+	 * Detects the first paint of the watched widget. The phase ends in the
+	 * next event loop iteration, when the paint event has been processed
+	 */
+	virtual bool eventFilter(QObject* watched, QEvent* event) override
+	{
+		if (watched == FirstPaintWidget && event->type() == QEvent::Paint)
+		{
+			FirstPaintWidget->removeEventFilter(this);
+			FirstPaintWidget = nullptr;
+			QTimer::singleShot(0, this, [this]()
+			{
+				endPhase("First paint");
+				printReport();
+			});
+		}
+		return QObject::eventFilter(watched, event);
+	}
+
+public:
+	bool Enabled = false; ///< true, if the report should be printed
+	int WidgetCount = 0; ///< number of synthetic dock widgets
+	int FloatingCount = 0; ///< number of synthetic floating containers
+
+	/**
+	 * Parses the command line options and starts the profile timer
+	 */
+	CStartupProfile(const QStringList& Arguments)
+	{
+		Enabled = Arguments.contains("--profile-startup");
+		WidgetCount = intOption(Arguments, "--widgets");
+		FloatingCount = qMin(intOption(Arguments, "--floating"), WidgetCount);
+		Timer.start();
+		PhaseTimer.start();
+	}
+
+	/**
+	 * Returns true, if a synthetic layout should be created instead of the
+	 * normal application content
+	 */
+	bool hasSyntheticLayout() const
+	{
+		return WidgetCount > 0;
+	}
+
+	/**
+	 * Starts a new phase. All time since the end of the last phase is
+	 * assigned to the next phase if this function is not called.
+	 */
+	void beginPhase()
+	{
+		PhaseTimer.restart();
+	}
+
+	/**
+	 * Ends the current phase and records its duration with the given name
+	 */
+	void endPhase(const QString& Name)
+	{
+		Phases.append(qMakePair(Name, PhaseTimer.nsecsElapsed()));
+		PhaseTimer.restart();
+	}
+
+	/**
+	 * Creates the synthetic dock widgets
+	 */
+	QList<ads::CDockWidget*> createDockWidgets()
+	{
+		beginPhase();
+		auto DockWidgets = CSyntheticLayout::createDockWidgets(WidgetCount);
+		endPhase("Dock widget creation");
+		return DockWidgets;
+	}
+
+	/**
+	 * Builds the synthetic layout from the given dock widgets. The first
+	 * FloatingCount dock widgets are put into floating containers.
+	 */
+	void buildLayout(ads::CDockManager* DockManager,
+		const QList<ads::CDockWidget*>& DockWidgets)
+	{
+		beginPhase();
+		{
+			ads::CDockLayoutChangeGuard LayoutChangeGuard(DockManager);
+			CSyntheticLayout::build(DockManager, DockWidgets, FloatingCount);
+		}
+		endPhase("Layout building");
+	}
+
+	/**
+	 * Saves the state of the dock manager and measures the time needed to
+	 * restore it again
+	 */
+	void profileRestoreState(ads::CDockManager* DockManager)
+	{
+		if (!Enabled)
+		{
+			return;
+		}
+
+		auto State = DockManager->saveState();
+		beginPhase();
+		DockManager->restoreState(State);
+		endPhase("Restore state");
+	}
+
+	/**
+	 * Measures the time until the first paint of the given widget has been
+	 * processed and prints the report afterwards. Call this function
+	 * immediately before the widget is shown.
+	 */
+	void profileFirstPaint(QWidget* Widget)
+	{
+		if (!Enabled)
+		{
+			return;
+		}
+
+		FirstPaintWidget = Widget;
+		Widget->installEventFilter(this);
+		beginPhase();
+	}
+
+	/**
+	 * Prints the duration of all recorded phases to stdout
+	 */
+	void printReport() const
+	{
+		QTextStream Stream(stdout);
+		Stream << "Startup profile";
+		if (hasSyntheticLayout())
+		{
+			Stream << " (" << WidgetCount << " widgets, " << FloatingCount
+				<< " floating)";
+		}
+		Stream << "\n";
+
+		qint64 PhasesNsecs = 0;
+		for (const auto& Phase : Phases)
+		{
+			PhasesNsecs += Phase.second;
+			Stream << QString("  %1 %2 ms\n").arg(Phase.first + ':', -24)
+				.arg(Phase.second / 1e6, 10, 'f', 3);
+		}
+		Stream << QString("  %1 %2 ms\n").arg("Sum of phases:", -24)
+			.arg(PhasesNsecs / 1e6, 10, 'f', 3);
+		Stream << QString("  %1 %2 ms\n").arg("Total:", -24)
+			.arg(Timer.nsecsElapsed() / 1e6, 10, 'f', 3);
+		Stream.flush();
+	}
+};
+
+//---------------------------------------------------------------------------
+#endif // StartupProfileH
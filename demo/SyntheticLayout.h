@@ -0,0 +1,108 @@
+#ifndef SyntheticLayoutH
+#define SyntheticLayoutH
+/*******************************************************************************
+** Qt Advanced Docking System
+** Copyright (C) 2017 Uwe Kindler
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 2.1 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+
+//============================================================================
+/// \file   SyntheticLayout.h
+/// \author Uwe Kindler
+/// \date   19.10.2026
+/// \brief  Synthetic reference layout for the demo, benchmarks and stress test
+//============================================================================
+
+
+//============================================================================
+//                                   INCLUDES
+//============================================================================
+#include <QLabel>
+#include <QList>
+#include <QString>
+
+#include "DockManager.h"
+#include "DockWidget.h"
+#include "DockAreaWidget.h"
+#include "FloatingDockContainer.h"
+
+
+/**
+ * Builds the synthetic layout that is used as reference workload by the
+ * startup profile of the demo and the examples, by the benchmarks and by
+ * the stress test. Using the same layout everywhere keeps the numbers of
+ * the different tools comparable.
+ */
+class CSyntheticLayout
+{
+public:
+	/**
+	 * Creates Count dock widgets with a label as content. The dock widgets
+	 * are named "<Prefix> <Index>".
+	 */
+	static QList<ads::CDockWidget*> createDockWidgets(int Count,
+		const QString& Prefix = "Synthetic")
+	{
+		QList<ads::CDockWidget*> DockWidgets;
+		for (int i = 0; i < Count; ++i)
+		{
+			auto DockWidget = new ads::CDockWidget(QString("%1 %2").arg(Prefix).arg(i));
+			DockWidget->setWidget(new QLabel(DockWidget->windowTitle()));
+			DockWidgets.append(DockWidget);
+		}
+		return DockWidgets;
+	}
+
+	/**
+	 * Adds the given dock widgets to the dock manager. The first
+	 * FloatingCount dock widgets are put into floating containers. The
+	 * remaining dock widgets are distributed into the four sides of the
+	 * dock manager. Every 16th dock widget opens a new dock area, all other
+	 * dock widgets are added as tabs to the existing areas, so the layout
+	 * contains splitters and tabbed areas.
+	 */
+	static void build(ads::CDockManager* DockManager,
+		const QList<ads::CDockWidget*>& DockWidgets, int FloatingCount = 0)
+	{
+		static const ads::DockWidgetArea Sides[] = {ads::LeftDockWidgetArea,
+			ads::RightDockWidgetArea, ads::TopDockWidgetArea, ads::BottomDockWidgetArea};
+
+		QList<ads::CDockAreaWidget*> DockAreas;
+		for (int i = 0; i < DockWidgets.count(); ++i)
+		{
+			auto DockWidget = DockWidgets[i];
+			if (i < FloatingCount)
+			{
+				auto FloatingWidget = DockManager->addDockWidgetFloating(DockWidget);
+				FloatingWidget->move(40 * (i + 1), 40 * (i + 1));
+			}
+			else if (DockAreas.count() < 4 || !(i % 16))
+			{
+				auto TargetArea = DockAreas.isEmpty() ? nullptr : DockAreas.last();
+				DockAreas.append(DockManager->addDockWidget(
+					Sides[DockAreas.count() % 4], DockWidget, TargetArea));
+			}
+			else
+			{
+				DockManager->addDockWidget(ads::CenterDockWidgetArea, DockWidget,
+					DockAreas.at(i % DockAreas.count()));
+			}
+		}
+	}
+};
+
+//---------------------------------------------------------------------------
+#endif // SyntheticLayoutH
@@ -23,7 +23,9 @@ SOURCES += \
 
 HEADERS += \
 	MainWindow.h \
-	StatusDialog.h
+	StatusDialog.h \
+	StartupProfile.h \
+	SyntheticLayout.h
 
 FORMS += \
 	mainwindow.ui \
@@ -1,4 +1,5 @@
 #include <MainWindow.h>
+#include "StartupProfile.h"
 #include <QString>
 #include <QFile>
 #include <QApplication>
@@ -41,6 +42,8 @@ int main(int argc, char *argv[])
 #endif
 	std::shared_ptr<int> b;
 	QApplication a(argc, argv);
+	// Supports --profile-startup, --widgets N and --floating M
+	CStartupProfile StartupProfile(a.arguments());
 	a.setApplicationName("Advanced Docking System Demo");
 	a.setQuitOnLastWindowClosed(true);
 
@@ -53,7 +56,7 @@ int main(int argc, char *argv[])
 	qInstallMessageHandler(myMessageOutput);
 	qDebug() << "Message handler test";
 
-	CMainWindow mw;
+	CMainWindow mw(&StartupProfile);
 	mw.show();
 	return a.exec();
 }
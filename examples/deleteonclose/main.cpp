@@ -4,6 +4,7 @@
 #include <QApplication>
 #include <QMenuBar>
 #include "DockManager.h"
+#include "DockComponentsFactory.h"
 
 int main(int argc, char *argv[])
 {
@@ -11,13 +12,16 @@ int main(int argc, char *argv[])
     QMainWindow w;
 
     auto dockManager = new ads::CDockManager(&w);
+    // Closed delete on close dock widgets and their tabs are recycled
+    dockManager->setDockWidgetPoolSize(16);
+    ads::CDockComponentsFactory::setDockWidgetTabPoolSize(16);
 
     QAction *action = new QAction("New Delete On Close", &w);
     w.menuBar()->addAction(action);
 
     int i = 0;
     QObject::connect(action, &QAction::triggered, [&]() {
-        auto dw = new ads::CDockWidget(QStringLiteral("test doc %1").arg(i++), &w);
+        auto dw = dockManager->createDockWidget(QStringLiteral("test doc %1").arg(i++));
         auto editor = new QTextEdit(QStringLiteral("lorem ipsum..."), dw);
         dw->setWidget(editor);
         dw->setFeature(ads::CDockWidget::DockWidgetDeleteOnClose, true);
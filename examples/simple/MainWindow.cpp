@@ -1,18 +1,41 @@
 #include "../../examples/simple/MainWindow.h"
 
 #include "ui_MainWindow.h"
+#include "../../demo/StartupProfile.h"
 
 #include <QLabel>
 
 MainWindow::MainWindow(QWidget *parent) :
+    MainWindow(nullptr, parent)
+{
+}
+
+MainWindow::MainWindow(CStartupProfile* StartupProfile, QWidget *parent) :
     QMainWindow(parent),
     ui(new Ui::MainWindow)
 {
     ui->setupUi(this);
 
+	if (StartupProfile)
+	{
+		StartupProfile->endPhase("Main window setup");
+	}
+
     // Create the dock manager. Because the parent parameter is a QMainWindow
     // the dock manager registers itself as the central widget.
 	m_DockManager = new ads::CDockManager(this);
+	if (StartupProfile)
+	{
+		StartupProfile->endPhase("Dock manager construction");
+		// The synthetic layout replaces the example content
+		if (StartupProfile->hasSyntheticLayout())
+		{
+			StartupProfile->buildLayout(m_DockManager, StartupProfile->createDockWidgets());
+			StartupProfile->profileRestoreState(m_DockManager);
+			StartupProfile->profileFirstPaint(m_DockManager);
+			return;
+		}
+	}
 
 	// Create example content label - this can be any application specific
 	// widget
@@ -32,6 +55,12 @@ MainWindow::MainWindow(QWidget *parent) :
 
 	// Add the dock widget to the top dock widget area
 	m_DockManager->addDockWidget(ads::TopDockWidgetArea, DockWidget);
+	if (StartupProfile)
+	{
+		StartupProfile->endPhase("Example content creation");
+		StartupProfile->profileRestoreState(m_DockManager);
+		StartupProfile->profileFirstPaint(m_DockManager);
+	}
 }
 
 MainWindow::~MainWindow()
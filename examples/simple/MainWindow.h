@@ -10,12 +10,15 @@ class MainWindow;
 }
 QT_END_NAMESPACE
 
+class CStartupProfile;
+
 class MainWindow : public QMainWindow
 {
     Q_OBJECT
 
 public:
     explicit MainWindow(QWidget *parent = 0);
+    explicit MainWindow(CStartupProfile* StartupProfile, QWidget *parent = 0);
     ~MainWindow();
 
 private:
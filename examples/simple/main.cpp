@@ -1,10 +1,13 @@
 #include <QApplication>
 #include "../../examples/simple/MainWindow.h"
+#include "../../demo/StartupProfile.h"
 
 int main(int argc, char *argv[])
 {
     QApplication a(argc, argv);
-    MainWindow w;
+    // Supports --profile-startup, --widgets N and --floating M
+    CStartupProfile StartupProfile(a.arguments());
+    MainWindow w(&StartupProfile);
     w.show();
 
     return a.exec();
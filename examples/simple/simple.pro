@@ -18,7 +18,9 @@ SOURCES += \
         MainWindow.cpp
 
 HEADERS += \
-        MainWindow.h
+        MainWindow.h \
+        ../../demo/StartupProfile.h \
+        ../../demo/SyntheticLayout.h
 
 FORMS += \
         MainWindow.ui
@@ -37,6 +37,8 @@
 #include <QApplication>
 #include <QtGlobal>
 
+#include <algorithm>
+
 #include "FloatingDockContainer.h"
 #include "DockAreaWidget.h"
 #include "DockOverlay.h"
@@ -59,6 +61,16 @@ struct DockAreaTabBarPrivate
 	QWidget* TabsContainerWidget;
 	QBoxLayout* TabsLayout;
 	int CurrentIndex = -1;
+	// Tab drag state. The positions of all other visible tabs are captured
+	// once when the tab drag starts, so finding the drop slot is a binary
+	// search and does not touch any widget geometry
+	CDockWidgetTab* DraggedTab = nullptr;
+	int DraggedTabIndex = -1;
+	int DraggedTabSlot = -1;
+	int DropSlot = -1;
+	QVector<int> DragTabCenters;
+	QVector<int> DragTabPositions;
+	QVector<int> DragTabIndexes;
 
 	/**
 	 * Private data constructor
@@ -80,6 +92,35 @@ struct DockAreaTabBarPrivate
 	 * Convenience function to access last tab
 	 */
 	CDockWidgetTab* lastTab() const {return _this->tab(_this->count() - 1);}
+
+	/**
+	 * Captures the positions of all visible tabs except the dragged tab
+	 */
+	void startTabDrag(CDockWidgetTab* Tab);
+
+	/**
+	 * Resets the tab drag state
+	 */
+	void finishTabDrag();
+
+	/**
+	 * Returns the drop slot for the given global mouse position. The slot
+	 * is the number of other visible tabs left of the mouse position
+	 */
+	int dropSlotAt(const QPoint& GlobalPos) const;
+
+	/**
+	 * Returns the layout index the dragged tab gets if it is dropped into
+	 * the given slot
+	 */
+	int layoutIndexForSlot(int Slot) const;
+
+	/**
+	 * Moves the tabs between the start position of the dragged tab and
+	 * the given drop slot aside to show the user where the tab will be
+	 * dropped. The tabs are only moved - the layout is not touched
+	 */
+	void showDropSlot(int Slot);
 };
 // struct DockAreaTabBarPrivate
 
@@ -117,6 +158,109 @@ void DockAreaTabBarPrivate::updateTabs()
 }
 
 
+//============================================================================
+void DockAreaTabBarPrivate::startTabDrag(CDockWidgetTab* Tab)
+{
+	DraggedTab = Tab;
+	DraggedTabIndex = TabsLayout->indexOf(Tab);
+	DraggedTabSlot = 0;
+	DragTabCenters.clear();
+	DragTabPositions.clear();
+	DragTabIndexes.clear();
+	for (int i = 0; i < _this->count(); ++i)
+	{
+		CDockWidgetTab* TabWidget = _this->tab(i);
+		if (TabWidget == Tab || !TabWidget->isVisibleTo(_this))
+		{
+			continue;
+		}
+
+		if (i < DraggedTabIndex)
+		{
+			DraggedTabSlot++;
+		}
+		// The layout arranges the tabs from left to right, so the centers
+		// are sorted
+		DragTabCenters.append(TabWidget->geometry().center().x());
+		DragTabPositions.append(TabWidget->x());
+		DragTabIndexes.append(i);
+	}
+	DropSlot = DraggedTabSlot;
+}
+
+
+//============================================================================
+void DockAreaTabBarPrivate::finishTabDrag()
+{
+	DraggedTab = nullptr;
+	DraggedTabIndex = -1;
+	DraggedTabSlot = -1;
+	DropSlot = -1;
+	DragTabCenters.clear();
+	DragTabPositions.clear();
+	DragTabIndexes.clear();
+}
+
+
+//============================================================================
+int DockAreaTabBarPrivate::dropSlotAt(const QPoint& GlobalPos) const
+{
+	int x = TabsContainerWidget->mapFromGlobal(GlobalPos).x();
+	auto it = std::upper_bound(DragTabCenters.begin(), DragTabCenters.end(), x);
+	return int(it - DragTabCenters.begin());
+}
+
+
+//============================================================================
+int DockAreaTabBarPrivate::layoutIndexForSlot(int Slot) const
+{
+	if (Slot > DraggedTabSlot)
+	{
+		return DragTabIndexes[Slot - 1];
+	}
+	else if (Slot < DraggedTabSlot)
+	{
+		return DragTabIndexes[Slot];
+	}
+	else
+	{
+		return DraggedTabIndex;
+	}
+}
+
+
+//============================================================================
+void DockAreaTabBarPrivate::showDropSlot(int Slot)
+{
+	if (Slot == DropSlot)
+	{
+		return;
+	}
+
+	// Only the tabs between the old and the new drop slot change their
+	// position
+	int Width = DraggedTab->width();
+	int First = qMin(qMin(Slot, DropSlot), DraggedTabSlot);
+	int Last = qMax(qMax(Slot, DropSlot), DraggedTabSlot);
+	for (int i = First; i < Last && i < DragTabIndexes.count(); ++i)
+	{
+		int Offset = 0;
+		if (i >= DraggedTabSlot && i < Slot)
+		{
+			Offset = -Width;
+		}
+		else if (i >= Slot && i < DraggedTabSlot)
+		{
+			Offset = Width;
+		}
+
+		CDockWidgetTab* TabWidget = _this->tab(DragTabIndexes[i]);
+		TabWidget->move(DragTabPositions[i] + Offset, TabWidget->y());
+	}
+	DropSlot = Slot;
+}
+
+
 //============================================================================
 CDockAreaTabBar::CDockAreaTabBar(CDockAreaWidget* parent) :
 	QScrollArea(parent),
@@ -201,6 +345,7 @@ void CDockAreaTabBar::insertTab(int Index, CDockWidgetTab* Tab)
 	connect(Tab, SIGNAL(clicked()), this, SLOT(onTabClicked()));
 	connect(Tab, SIGNAL(closeRequested()), this, SLOT(onTabCloseRequested()));
 	connect(Tab, SIGNAL(closeOtherTabsRequested()), this, SLOT(onCloseOtherTabsRequested()));
+	connect(Tab, SIGNAL(moving(const QPoint&)), this, SLOT(onTabWidgetMoving(const QPoint&)));
 	connect(Tab, SIGNAL(moved(const QPoint&)), this, SLOT(onTabWidgetMoved(const QPoint&)));
 	connect(Tab, SIGNAL(elidedChanged(bool)), this, SIGNAL(elidedChanged(bool)));
 	Tab->installEventFilter(this);
@@ -226,6 +371,7 @@ void CDockAreaTabBar::removeTab(CDockWidgetTab* Tab)
 		return;
 	}
     ADS_PRINT("CDockAreaTabBar::removeTab ");
+	d->finishTabDrag();
 	int NewCurrentIndex = currentIndex();
 	int RemoveIndex = d->TabsLayout->indexOf(Tab);
 	if (count() == 1)
@@ -335,27 +481,19 @@ void CDockAreaTabBar::onTabCloseRequested()
 void CDockAreaTabBar::onCloseOtherTabsRequested()
 {
 	auto Sender = qobject_cast<CDockWidgetTab*>(sender());
+	QList<CDockWidget*> DockWidgets;
 	for (int i = 0; i < count(); ++i)
 	{
 		auto Tab = tab(i);
 		if (Tab->isClosable() && !Tab->isHidden() && Tab != Sender)
 		{
-			// If the dock widget is deleted with the closeTab() call, its tab
-			// it will no longer be in the layout, and thus the index needs to
-			// be updated to not skip any tabs
-			int Offset = Tab->dockWidget()->features().testFlag(
-				CDockWidget::DockWidgetDeleteOnClose) ? 1 : 0;
-			closeTab(i);
-
-			// If the the dock widget blocks closing, i.e. if the flag
-			// CustomCloseHandling is set, and the dock widget is still open,
-			// then we do not need to correct the index
-			if (Tab->dockWidget()->isClosed())
-			{
-				i -= Offset;
-			}
+			DockWidgets.append(Tab->dockWidget());
 		}
 	}
+
+	// Closing all tabs in one batch avoids the update of the dock area and
+	// the layout for each single closed tab
+	d->DockArea->dockManager()->closeDockWidgets(DockWidgets);
 }
 
 
@@ -371,7 +509,7 @@ CDockWidgetTab* CDockAreaTabBar::tab(int Index) const
 
 
 //===========================================================================
-void CDockAreaTabBar::onTabWidgetMoved(const QPoint& GlobalPos)
+void CDockAreaTabBar::onTabWidgetMoving(const QPoint& GlobalPos)
 {
 	CDockWidgetTab* MovingTab = qobject_cast<CDockWidgetTab*>(sender());
 	if (!MovingTab)
@@ -379,30 +517,31 @@ void CDockAreaTabBar::onTabWidgetMoved(const QPoint& GlobalPos)
 		return;
 	}
 
-	int fromIndex = d->TabsLayout->indexOf(MovingTab);
-	auto MousePos = mapFromGlobal(GlobalPos);
-	MousePos.rx() = qMax(d->firstTab()->geometry().left(), MousePos.x());
-	MousePos.rx() = qMin(d->lastTab()->geometry().right(), MousePos.x());
-	int toIndex = -1;
-	// Find tab under mouse
-	for (int i = 0; i < count(); ++i)
+	if (d->DraggedTab != MovingTab)
 	{
-		CDockWidgetTab* DropTab = tab(i);
-		if (DropTab == MovingTab || !DropTab->isVisibleTo(this)
-		    || !DropTab->geometry().contains(MousePos))
-		{
-			continue;
-		}
+		d->startTabDrag(MovingTab);
+	}
+	d->showDropSlot(d->dropSlotAt(GlobalPos));
+}
 
-		toIndex = d->TabsLayout->indexOf(DropTab);
-		if (toIndex == fromIndex)
-		{
-			toIndex = -1;
-		}
-		break;
+
+//===========================================================================
+void CDockAreaTabBar::onTabWidgetMoved(const QPoint& GlobalPos)
+{
+	CDockWidgetTab* MovingTab = qobject_cast<CDockWidgetTab*>(sender());
+	if (!MovingTab)
+	{
+		return;
 	}
 
-	if (toIndex > -1)
+	if (d->DraggedTab != MovingTab)
+	{
+		d->startTabDrag(MovingTab);
+	}
+	int fromIndex = d->DraggedTabIndex;
+	int toIndex = d->layoutIndexForSlot(d->dropSlotAt(GlobalPos));
+	d->finishTabDrag();
+	if (toIndex != fromIndex)
 	{
 		d->TabsLayout->removeWidget(MovingTab);
 		d->TabsLayout->insertWidget(toIndex, MovingTab);
@@ -412,7 +551,8 @@ void CDockAreaTabBar::onTabWidgetMoved(const QPoint& GlobalPos)
 	}
 	else
 	{
-		// Ensure that the moved tab is reset to its start position
+		// Ensure that the moved tab and the tabs that have been moved aside
+		// are reset to their layout position
 		d->TabsLayout->update();
 	}
 }
@@ -446,6 +586,12 @@ bool CDockAreaTabBar::eventFilter(QObject *watched, QEvent *event)
 
 	switch (event->type())
 	{
+	case QEvent::MouseButtonPress:
+		 // A new tab drag may start - the captured tab positions of a
+		 // previous drag that has not been finished are invalid now
+		 d->finishTabDrag();
+		 break;
+
 	case QEvent::Hide:
 		 emit tabClosed(d->TabsLayout->indexOf(Tab));
 		 updateGeometry();
@@ -38,6 +38,7 @@
 #include <QMouseEvent>
 #include <QDebug>
 #include <QPointer>
+#include <QHash>
 
 #include "DockAreaTitleBar_p.h"
 #include "ads_globals.h"
@@ -56,6 +57,14 @@
 
 namespace ads
 {
+/**
+ * State of a title bar button that is applied when the button is created
+ */
+struct TitleBarButtonState
+{
+	bool Visible = true;
+	bool Enabled = true;
+};
 
 /**
  * Private data class of CDockAreaTitleBar class (pimpl)
@@ -66,12 +75,18 @@ struct DockAreaTitleBarPrivate
 	QPointer<tTitleBarButton> TabsMenuButton;
 	QPointer<tTitleBarButton> UndockButton;
 	QPointer<tTitleBarButton> CloseButton;
+	TitleBarButtonState ButtonStates[TitleBarButtonClose + 1];
+	bool ButtonsCreated = false;
 	QBoxLayout* Layout;
 	CDockAreaWidget* DockArea;
 	CDockAreaTabBar* TabBar;
 	bool MenuOutdated = true;
 	QMenu* TabsMenu;
-	QList<tTitleBarButton*> DockWidgetActionsButtons;
+	// The title bar action buttons of each dock widget are created once and
+	// kept in a container widget that is shown if the dock widget is the
+	// current dock widget
+	QHash<CDockWidget*, QWidget*> DockWidgetActionsButtons;
+	QWidget* CurrentActionsButtons = nullptr;
 
 	QPoint DragStartMousePos;
 	eDragState DragState = DraggingInactive;
@@ -84,10 +99,47 @@ struct DockAreaTitleBarPrivate
 	DockAreaTitleBarPrivate(CDockAreaTitleBar* _public);
 
 	/**
-	 * Creates the title bar close and menu buttons
+	 * Creates the title bar buttons that are enabled via the config flags.
+	 * This function is called when the title bar is shown the first time.
 	 */
 	void createButtons();
 
+	/**
+	 * Returns the given button and creates it, if it does not exist yet
+	 */
+	tTitleBarButton* createButton(TitleBarButton which);
+
+	/**
+	 * Returns the pointer that stores the given button
+	 */
+	QPointer<tTitleBarButton>& buttonPointer(TitleBarButton which)
+	{
+		switch (which)
+		{
+		case TitleBarButtonTabsMenu: return TabsMenuButton;
+		case TitleBarButtonUndock: return UndockButton;
+		default: return CloseButton;
+		}
+	}
+
+	/**
+	 * Returns the layout index for a widget that is inserted in front of the
+	 * given button. The title bar buttons are created on demand, so the
+	 * index is the index of the first existing button that follows.
+	 */
+	int buttonInsertIndex(TitleBarButton which)
+	{
+		for (int i = which; i <= TitleBarButtonClose; ++i)
+		{
+			auto Button = buttonPointer(static_cast<TitleBarButton>(i));
+			if (Button)
+			{
+				return Layout->indexOf(Button);
+			}
+		}
+		return Layout->count();
+	}
+
 	/**
 	 * Creates the internal TabBar
 	 */
@@ -127,6 +179,12 @@ struct DockAreaTitleBarPrivate
 	 * Makes the dock area floating
 	 */
 	IFloatingWidget* makeAreaFloating(const QPoint& Offset, eDragState DragState);
+
+	/**
+	 * Creates the container widget with the title bar action buttons for
+	 * the given dock widget
+	 */
+	QWidget* createDockWidgetActionsButtons(CDockWidget* DockWidget);
 };// struct DockAreaTitleBarPrivate
 
 //============================================================================
@@ -140,53 +198,99 @@ DockAreaTitleBarPrivate::DockAreaTitleBarPrivate(CDockAreaTitleBar* _public) :
 //============================================================================
 void DockAreaTitleBarPrivate::createButtons()
 {
-	QSizePolicy ButtonSizePolicy(QSizePolicy::Fixed, QSizePolicy::Expanding);
+	if (ButtonsCreated)
+	{
+		return;
+	}
 
-	// Tabs menu button
-	TabsMenuButton = new CTitleBarButton(testConfigFlag(CDockManager::DockAreaHasTabsMenuButton));
-	TabsMenuButton->setObjectName("tabsMenuButton");
-	TabsMenuButton->setAutoRaise(true);
-	TabsMenuButton->setPopupMode(QToolButton::InstantPopup);
-	internal::setButtonIcon(TabsMenuButton, QStyle::SP_TitleBarUnshadeButton, ads::DockAreaMenuIcon);
-	QMenu* TabsMenu = new QMenu(TabsMenuButton);
+	ButtonsCreated = true;
+	if (testConfigFlag(CDockManager::DockAreaHasTabsMenuButton))
+	{
+		createButton(TitleBarButtonTabsMenu);
+	}
+	if (testConfigFlag(CDockManager::DockAreaHasUndockButton))
+	{
+		createButton(TitleBarButtonUndock);
+	}
+	if (testConfigFlag(CDockManager::DockAreaHasCloseButton))
+	{
+		createButton(TitleBarButtonClose);
+	}
+}
+
+
+//============================================================================
+tTitleBarButton* DockAreaTitleBarPrivate::createButton(TitleBarButton which)
+{
+	auto& Button = buttonPointer(which);
+	if (Button)
+	{
+		return Button;
+	}
+
+	QSizePolicy ButtonSizePolicy(QSizePolicy::Fixed, QSizePolicy::Expanding);
+	int Index = buttonInsertIndex(which);
+	switch (which)
+	{
+	case TitleBarButtonTabsMenu:
+		{
+			Button = new CTitleBarButton(testConfigFlag(CDockManager::DockAreaHasTabsMenuButton));
+			Button->setObjectName("tabsMenuButton");
+			Button->setAutoRaise(true);
+			Button->setPopupMode(QToolButton::InstantPopup);
+			internal::setButtonIcon(Button, QStyle::SP_TitleBarUnshadeButton, ads::DockAreaMenuIcon);
+			TabsMenu = new QMenu(Button);
 #ifndef QT_NO_TOOLTIP
-	TabsMenu->setToolTipsVisible(true);
+			TabsMenu->setToolTipsVisible(true);
 #endif
-	_this->connect(TabsMenu, SIGNAL(aboutToShow()), SLOT(onTabsMenuAboutToShow()));
-	TabsMenuButton->setMenu(TabsMenu);
-	internal::setToolTip(TabsMenuButton, QObject::tr("List All Tabs"));
-	TabsMenuButton->setSizePolicy(ButtonSizePolicy);
-	Layout->addWidget(TabsMenuButton, 0);
-	_this->connect(TabsMenuButton->menu(), SIGNAL(triggered(QAction*)),
-		SLOT(onTabsMenuActionTriggered(QAction*)));
-
-	// Undock button
-	UndockButton = new CTitleBarButton(testConfigFlag(CDockManager::DockAreaHasUndockButton));
-	UndockButton->setObjectName("undockButton");
-	UndockButton->setAutoRaise(true);
-	internal::setToolTip(UndockButton, QObject::tr("Detach Group"));
-	internal::setButtonIcon(UndockButton, QStyle::SP_TitleBarNormalButton, ads::DockAreaUndockIcon);
-	UndockButton->setSizePolicy(ButtonSizePolicy);
-	Layout->addWidget(UndockButton, 0);
-	_this->connect(UndockButton, SIGNAL(clicked()), SLOT(onUndockButtonClicked()));
-
-	// Close button
-	CloseButton = new CTitleBarButton(testConfigFlag(CDockManager::DockAreaHasCloseButton));
-	CloseButton->setObjectName("closeButton");
-	CloseButton->setAutoRaise(true);
-	internal::setButtonIcon(CloseButton, QStyle::SP_TitleBarCloseButton, ads::DockAreaCloseIcon);
-	if (testConfigFlag(CDockManager::DockAreaCloseButtonClosesTab))
-	{
-		internal::setToolTip(CloseButton, QObject::tr("Close Active Tab"));
+			_this->connect(TabsMenu, SIGNAL(aboutToShow()), SLOT(onTabsMenuAboutToShow()));
+			Button->setMenu(TabsMenu);
+			internal::setToolTip(Button, QObject::tr("List All Tabs"));
+			_this->connect(TabsMenu, SIGNAL(triggered(QAction*)),
+				SLOT(onTabsMenuActionTriggered(QAction*)));
+		}
+		break;
+
+	case TitleBarButtonUndock:
+		Button = new CTitleBarButton(testConfigFlag(CDockManager::DockAreaHasUndockButton));
+		Button->setObjectName("undockButton");
+		Button->setAutoRaise(true);
+		internal::setToolTip(Button, QObject::tr("Detach Group"));
+		internal::setButtonIcon(Button, QStyle::SP_TitleBarNormalButton, ads::DockAreaUndockIcon);
+		_this->connect(Button, SIGNAL(clicked()), SLOT(onUndockButtonClicked()));
+		break;
+
+	case TitleBarButtonClose:
+		Button = new CTitleBarButton(testConfigFlag(CDockManager::DockAreaHasCloseButton));
+		Button->setObjectName("closeButton");
+		Button->setAutoRaise(true);
+		internal::setButtonIcon(Button, QStyle::SP_TitleBarCloseButton, ads::DockAreaCloseIcon);
+		if (testConfigFlag(CDockManager::DockAreaCloseButtonClosesTab))
+		{
+			internal::setToolTip(Button, QObject::tr("Close Active Tab"));
+		}
+		else
+		{
+			internal::setToolTip(Button, QObject::tr("Close Group"));
+		}
+		Button->setIconSize(QSize(16, 16));
+		_this->connect(Button, SIGNAL(clicked()), SLOT(onCloseButtonClicked()));
+		break;
 	}
-	else
+
+	Button->setSizePolicy(ButtonSizePolicy);
+	// Apply the state that has been set before the button existed
+	const auto& State = ButtonStates[which];
+	if (!State.Enabled)
+	{
+		Button->setEnabled(false);
+	}
+	if (!State.Visible)
 	{
-		internal::setToolTip(CloseButton, QObject::tr("Close Group"));
+		Button->setVisible(false);
 	}
-	CloseButton->setSizePolicy(ButtonSizePolicy);
-	CloseButton->setIconSize(QSize(16, 16));
-	Layout->addWidget(CloseButton, 0);
-	_this->connect(CloseButton, SIGNAL(clicked()), SLOT(onCloseButtonClicked()));
+	Layout->insertWidget(Index, Button, 0);
+	return Button;
 }
 
 
@@ -200,6 +304,7 @@ void DockAreaTitleBarPrivate::createTabBar()
 	_this->connect(TabBar, SIGNAL(tabOpened(int)), SLOT(markTabsMenuOutdated()));
 	_this->connect(TabBar, SIGNAL(tabInserted(int)), SLOT(markTabsMenuOutdated()));
 	_this->connect(TabBar, SIGNAL(removingTab(int)), SLOT(markTabsMenuOutdated()));
+	_this->connect(TabBar, SIGNAL(removingTab(int)), SLOT(onRemovingTab(int)));
 	_this->connect(TabBar, SIGNAL(tabMoved(int, int)), SLOT(markTabsMenuOutdated()));
 	_this->connect(TabBar, SIGNAL(currentChanged(int)), SLOT(onCurrentTabChanged(int)));
 	_this->connect(TabBar, SIGNAL(tabBarClicked(int)), SIGNAL(tabBarClicked(int)));
@@ -207,6 +312,37 @@ void DockAreaTitleBarPrivate::createTabBar()
 }
 
 
+//============================================================================
+QWidget* DockAreaTitleBarPrivate::createDockWidgetActionsButtons(CDockWidget* DockWidget)
+{
+	auto Actions = DockWidget->titleBarActions();
+	if (Actions.isEmpty())
+	{
+		return nullptr;
+	}
+
+	QWidget* ButtonsWidget = new QWidget(_this);
+	ButtonsWidget->setObjectName("dockWidgetActionsButtons");
+	QBoxLayout* ButtonsLayout = new QBoxLayout(QBoxLayout::LeftToRight);
+	ButtonsLayout->setContentsMargins(0, 0, 0, 0);
+	ButtonsLayout->setSpacing(0);
+	ButtonsWidget->setLayout(ButtonsLayout);
+	for (auto Action : Actions)
+	{
+		auto Button = new CTitleBarButton(true, ButtonsWidget);
+		Button->setDefaultAction(Action);
+		Button->setAutoRaise(true);
+		Button->setPopupMode(QToolButton::InstantPopup);
+		Button->setObjectName(Action->objectName());
+		ButtonsLayout->addWidget(Button, 0);
+	}
+
+	ButtonsWidget->hide();
+	Layout->insertWidget(buttonInsertIndex(TitleBarButtonTabsMenu), ButtonsWidget, 0);
+	return ButtonsWidget;
+}
+
+
 //============================================================================
 IFloatingWidget* DockAreaTitleBarPrivate::makeAreaFloating(const QPoint& Offset, eDragState DragState)
 {
@@ -267,7 +403,6 @@ CDockAreaTitleBar::CDockAreaTitleBar(CDockAreaWidget* parent) :
 
 	d->createTabBar();
 	d->Layout->addWidget(new CSpacerWidget(this));
-	d->createButtons();
 }
 
 
@@ -318,7 +453,14 @@ void CDockAreaTitleBar::markTabsMenuOutdated()
 			}
 		}
 		bool visible = (hasElidedTabTitle && (d->TabBar->count() > 1));
-		QMetaObject::invokeMethod(d->TabsMenuButton, "setVisible", Qt::QueuedConnection, Q_ARG(bool, visible));
+		if (d->TabsMenuButton)
+		{
+			QMetaObject::invokeMethod(d->TabsMenuButton, "setVisible", Qt::QueuedConnection, Q_ARG(bool, visible));
+		}
+		else
+		{
+			d->ButtonStates[TitleBarButtonTabsMenu].Visible = visible;
+		}
 	}
 	d->MenuOutdated = true;
 }
@@ -386,37 +528,82 @@ void CDockAreaTitleBar::onTabsMenuActionTriggered(QAction* Action)
 //============================================================================
 void CDockAreaTitleBar::updateDockWidgetActionsButtons()
 {
-	CDockWidget* DockWidget = d->TabBar->currentTab()->dockWidget();
-	if (!d->DockWidgetActionsButtons.isEmpty())
+	auto CurrentTab = d->TabBar->currentTab();
+	CDockWidget* DockWidget = CurrentTab ? CurrentTab->dockWidget() : nullptr;
+	QWidget* ButtonsWidget = nullptr;
+	if (DockWidget)
 	{
-		for (auto Button : d->DockWidgetActionsButtons)
+		auto it = d->DockWidgetActionsButtons.find(DockWidget);
+		if (it == d->DockWidgetActionsButtons.end())
 		{
-			d->Layout->removeWidget(Button);
-			delete Button;
+			it = d->DockWidgetActionsButtons.insert(DockWidget,
+				d->createDockWidgetActionsButtons(DockWidget));
 		}
-		d->DockWidgetActionsButtons.clear();
+		ButtonsWidget = it.value();
 	}
 
-	auto Actions = DockWidget->titleBarActions();
-	if (Actions.isEmpty())
+	if (ButtonsWidget == d->CurrentActionsButtons)
 	{
 		return;
 	}
 
-	int InsertIndex = indexOf(d->TabsMenuButton);
-	for (auto Action : Actions)
+	if (d->CurrentActionsButtons)
 	{
-		auto Button = new CTitleBarButton(true, this);
-		Button->setDefaultAction(Action);
-		Button->setAutoRaise(true);
-		Button->setPopupMode(QToolButton::InstantPopup);
-		Button->setObjectName(Action->objectName());
-		d->Layout->insertWidget(InsertIndex++, Button, 0);
-		d->DockWidgetActionsButtons.append(Button);
+		d->CurrentActionsButtons->hide();
+	}
+	d->CurrentActionsButtons = ButtonsWidget;
+	if (ButtonsWidget)
+	{
+		ButtonsWidget->show();
 	}
 }
 
 
+//============================================================================
+void CDockAreaTitleBar::invalidateDockWidgetActionsButtons(CDockWidget* DockWidget)
+{
+	QWidget* ButtonsWidget = d->DockWidgetActionsButtons.take(DockWidget);
+	if (!ButtonsWidget)
+	{
+		return;
+	}
+
+	if (ButtonsWidget == d->CurrentActionsButtons)
+	{
+		d->CurrentActionsButtons = nullptr;
+	}
+	d->Layout->removeWidget(ButtonsWidget);
+	delete ButtonsWidget;
+	updateDockWidgetActionsButtons();
+}
+
+
+//============================================================================
+void CDockAreaTitleBar::onRemovingTab(int Index)
+{
+	auto Tab = d->TabBar->tab(Index);
+	if (!Tab)
+	{
+		return;
+	}
+
+	// The buttons belong to this title bar, so they are useless if the
+	// dock widget is moved into another dock area
+	QWidget* ButtonsWidget = d->DockWidgetActionsButtons.take(Tab->dockWidget());
+	if (!ButtonsWidget)
+	{
+		return;
+	}
+
+	if (ButtonsWidget == d->CurrentActionsButtons)
+	{
+		d->CurrentActionsButtons = nullptr;
+	}
+	d->Layout->removeWidget(ButtonsWidget);
+	ButtonsWidget->deleteLater();
+}
+
+
 //============================================================================
 void CDockAreaTitleBar::onCurrentTabChanged(int Index)
 {
@@ -428,7 +615,8 @@ void CDockAreaTitleBar::onCurrentTabChanged(int Index)
 	if (d->testConfigFlag(CDockManager::DockAreaCloseButtonClosesTab))
 	{
 		CDockWidget* DockWidget = d->TabBar->tab(Index)->dockWidget();
-		d->CloseButton->setEnabled(DockWidget->features().testFlag(CDockWidget::DockWidgetClosable));
+		setButtonEnabled(TitleBarButtonClose,
+			DockWidget->features().testFlag(CDockWidget::DockWidgetClosable));
 	}
 
 	updateDockWidgetActionsButtons();
@@ -440,18 +628,49 @@ QAbstractButton* CDockAreaTitleBar::button(TitleBarButton which) const
 {
 	switch (which)
 	{
-	case TitleBarButtonTabsMenu: return d->TabsMenuButton;
-	case TitleBarButtonUndock: return d->UndockButton;
-	case TitleBarButtonClose: return d->CloseButton;
+	case TitleBarButtonTabsMenu:
+	case TitleBarButtonUndock:
+	case TitleBarButtonClose:
+		return d->createButton(which);
 	default:
 		return nullptr;
 	}
 }
 
 
+//============================================================================
+void CDockAreaTitleBar::setButtonVisible(TitleBarButton which, bool Visible)
+{
+	d->ButtonStates[which].Visible = Visible;
+	auto Button = d->buttonPointer(which);
+	if (Button)
+	{
+		Button->setVisible(Visible);
+	}
+}
+
+
+//============================================================================
+void CDockAreaTitleBar::setButtonEnabled(TitleBarButton which, bool Enabled)
+{
+	d->ButtonStates[which].Enabled = Enabled;
+	auto Button = d->buttonPointer(which);
+	if (Button)
+	{
+		Button->setEnabled(Enabled);
+	}
+}
+
+
 //============================================================================
 void CDockAreaTitleBar::setVisible(bool Visible)
 {
+	// The buttons are created before the base class shows the title bar,
+	// so they are shown together with all other child widgets
+	if (Visible)
+	{
+		d->createButtons();
+	}
 	Super::setVisible(Visible);
 	markTabsMenuOutdated();
 }
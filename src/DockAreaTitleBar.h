@@ -40,6 +40,7 @@ namespace ads
 {
 class CDockAreaTabBar;
 class CDockAreaWidget;
+class CDockWidget;
 struct DockAreaTitleBarPrivate;
 
 /**
@@ -60,6 +61,7 @@ private slots:
 	void onUndockButtonClicked();
 	void onTabsMenuActionTriggered(QAction* Action);
 	void onCurrentTabChanged(int Index);
+	void onRemovingTab(int Index);
 
 protected:
 		/**
@@ -115,18 +117,46 @@ public:
 	CDockAreaTabBar* tabBar() const;
 
 	/**
-	 * Returns the button corresponding to the given title bar button identifier
+	 * Returns the button corresponding to the given title bar button identifier.
+	 * The title bar buttons are created when the title bar is shown the
+	 * first time. Buttons that are disabled via the config flags are
+	 * created on first access by this function.
 	 */
 	QAbstractButton* button(TitleBarButton which) const;
 
 	/**
-	 * Updates the visibility of the dock widget actions in the title bar
+	 * Sets the visibility of the given title bar button.
+	 * If the button has not been created yet, the visibility is applied
+	 * when the button is created.
+	 */
+	void setButtonVisible(TitleBarButton which, bool Visible);
+
+	/**
+	 * Enables or disables the given title bar button.
+	 * If the button has not been created yet, the state is applied when the
+	 * button is created.
+	 */
+	void setButtonEnabled(TitleBarButton which, bool Enabled);
+
+	/**
+	 * Updates the visibility of the dock widget actions in the title bar.
+	 * The action buttons of each dock widget are created only once, when
+	 * the dock widget becomes the current dock widget the first time.
+	 * Switching the current dock widget only swaps the visible buttons.
 	 */
 	void updateDockWidgetActionsButtons();
 
+	/**
+	 * Deletes the cached title bar action buttons of the given dock widget.
+	 * This function is called by CDockWidget::setTitleBarActions() to
+	 * recreate the buttons with the new actions.
+	 */
+	void invalidateDockWidgetActionsButtons(CDockWidget* DockWidget);
+
 	/**
 	 * Marks the tabs menu outdated before it calls its base class
-	 * implementation
+	 * implementation. Creates the title bar buttons if the title bar is
+	 * shown the first time.
 	 */
 	virtual void setVisible(bool Visible) override;
 
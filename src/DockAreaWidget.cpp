@@ -56,6 +56,7 @@
 #include "DockAreaTitleBar.h"
 #include "DockComponentsFactory.h"
 #include "DockWidgetTab.h"
+#include "DockTrace.h"
 
 
 namespace ads
@@ -152,6 +153,7 @@ public:
 	 */
 	void setCurrentIndex(int index)
 	{
+		ADS_TRACE_SCOPE("DockAreaLayout::setCurrentIndex");
 		QWidget *prev = currentWidget();
 		QWidget *next = widget(index);
 		if (!next || (next == prev && !m_CurrentWidget))
@@ -305,6 +307,18 @@ struct DockAreaWidgetPrivate
 	 */
 	void updateTitleBarButtonStates();
 
+	/**
+	 * Marks the layout model of the dock container as outdated
+	 */
+	void markLayoutModelDirty()
+	{
+		auto Container = _this->dockContainer();
+		if (Container)
+		{
+			Container->markLayoutModelDirty();
+		}
+	}
+
 	/**
 	 * Scans all contained dock widgets for the max. minimum size hint
 	 */
@@ -344,15 +358,15 @@ void DockAreaWidgetPrivate::createTitleBar()
 //============================================================================
 void DockAreaWidgetPrivate::updateTitleBarButtonStates()
 {
-	if (_this->isHidden())
+	if (_this->isHidden() || (DockManager && DockManager->isLayoutChangeActive()))
 	{
 		UpdateTitleBarButtons = true;
 		return;
 	}
 
-	TitleBar->button(TitleBarButtonClose)->setEnabled(
+	TitleBar->setButtonEnabled(TitleBarButtonClose,
 		_this->features().testFlag(CDockWidget::DockWidgetClosable));
-	TitleBar->button(TitleBarButtonUndock)->setEnabled(
+	TitleBar->setButtonEnabled(TitleBarButtonUndock,
 		_this->features().testFlag(CDockWidget::DockWidgetFloatable));
 	TitleBar->updateDockWidgetActionsButtons();
 	UpdateTitleBarButtons = false;
@@ -413,6 +427,7 @@ void CDockAreaWidget::insertDockWidget(int index, CDockWidget* DockWidget,
 	bool Activate)
 {
 	d->ContentsLayout->insertWidget(index, DockWidget);
+	d->markLayoutModelDirty();
 	DockWidget->tabWidget()->setDockAreaWidget(this);
 	auto TabWidget = DockWidget->tabWidget();
 	// Inserting the tab will change the current index which in turn will
@@ -439,6 +454,54 @@ void CDockAreaWidget::insertDockWidget(int index, CDockWidget* DockWidget,
 }
 
 
+//============================================================================
+void CDockAreaWidget::appendDockWidgets(const QList<CDockWidget*>& DockWidgets)
+{
+	if (DockWidgets.isEmpty())
+	{
+		return;
+	}
+
+	d->markLayoutModelDirty();
+	auto TabBar = d->tabBar();
+	CDockWidget* CurrentDockWidget = nullptr;
+	TabBar->blockSignals(true);
+	for (auto DockWidget : DockWidgets)
+	{
+		int Index = d->ContentsLayout->count();
+		d->ContentsLayout->insertWidget(Index, DockWidget);
+		auto TabWidget = DockWidget->tabWidget();
+		TabWidget->setDockAreaWidget(this);
+		TabBar->insertTab(Index, TabWidget);
+		TabWidget->setVisible(!DockWidget->isClosed());
+		DockWidget->setProperty(INDEX_PROPERTY, Index);
+		DockWidget->setDockArea(this);
+		if (!DockWidget->isClosed())
+		{
+			CurrentDockWidget = DockWidget;
+		}
+	}
+	TabBar->blockSignals(false);
+	d->updateMinimumSizeHint();
+
+	if (CurrentDockWidget)
+	{
+		setCurrentDockWidget(CurrentDockWidget);
+	}
+
+	// Same as in insertDockWidget() - a hidden dock area is made visible
+	// again by the new dock widgets
+	if (!this->isVisible() && d->ContentsLayout->count() > 1 && !dockManager()->isRestoringState())
+	{
+		for (auto DockWidget : DockWidgets)
+		{
+			DockWidget->toggleViewInternal(true);
+		}
+	}
+	d->updateTitleBarButtonStates();
+}
+
+
 //============================================================================
 void CDockAreaWidget::removeDockWidget(CDockWidget* DockWidget)
 {
@@ -446,6 +509,7 @@ void CDockAreaWidget::removeDockWidget(CDockWidget* DockWidget)
 	auto NextOpenDockWidget = nextOpenDockWidget(DockWidget);
 
 	d->ContentsLayout->removeWidget(DockWidget);
+	d->markLayoutModelDirty();
 	auto TabWidget = DockWidget->tabWidget();
 	TabWidget->hide();
 	d->tabBar()->removeTab(TabWidget);
@@ -591,6 +655,7 @@ void CDockAreaWidget::setCurrentIndex(int index)
     emit currentChanging(index);
     TabBar->setCurrentIndex(index);
 	d->ContentsLayout->setCurrentIndex(index);
+	d->markLayoutModelDirty();
 	d->ContentsLayout->currentWidget()->show();
 	emit currentChanged(index);
 }
@@ -709,6 +774,7 @@ void CDockAreaWidget::reorderDockWidget(int fromIndex, int toIndex)
 	auto Widget = d->ContentsLayout->widget(fromIndex);
 	d->ContentsLayout->removeWidget(Widget);
 	d->ContentsLayout->insertWidget(toIndex, Widget);
+	d->markLayoutModelDirty();
 	setCurrentIndex(toIndex);
 }
 
@@ -718,10 +784,27 @@ void CDockAreaWidget::toggleDockWidgetView(CDockWidget* DockWidget, bool Open)
 {
 	Q_UNUSED(DockWidget);
 	Q_UNUSED(Open);
+	d->markLayoutModelDirty();
 	updateTitleBarVisibility();
 }
 
 
+//============================================================================
+void CDockAreaWidget::resizeEvent(QResizeEvent* event)
+{
+	Super::resizeEvent(event);
+	d->markLayoutModelDirty();
+}
+
+
+//============================================================================
+void CDockAreaWidget::moveEvent(QMoveEvent* event)
+{
+	Super::moveEvent(event);
+	d->markLayoutModelDirty();
+}
+
+
 //============================================================================
 void CDockAreaWidget::updateTitleBarVisibility()
 {
@@ -736,6 +819,13 @@ void CDockAreaWidget::updateTitleBarVisibility()
         return;
     }
 
+	// The title bar visibility is updated once if the layout change is
+	// committed
+	if (d->DockManager && d->DockManager->isLayoutChangeActive())
+	{
+		return;
+	}
+
 	if (d->TitleBar)
 	{
 		bool Hidden = Container->hasTopLevelDockWidget() && (Container->isFloating()
@@ -745,6 +835,17 @@ void CDockAreaWidget::updateTitleBarVisibility()
 }
 
 
+//============================================================================
+void CDockAreaWidget::commitLayoutChange()
+{
+	updateTitleBarVisibility();
+	if (d->UpdateTitleBarButtons)
+	{
+		d->updateTitleBarButtonStates();
+	}
+}
+
+
 //============================================================================
 void CDockAreaWidget::markTitleBarMenuOutdated()
 {
@@ -872,10 +973,9 @@ void CDockAreaWidget::closeArea()
 	}
 	else
 	{
-		for (auto DockWidget : openedDockWidgets())
-		{
-			DockWidget->toggleView(false);
-		}
+		// All dock widgets are hidden in one batch so that the dock area is
+		// hidden only once
+		d->DockManager->closeDockWidgetsInternal({}, OpenDockWidgets);
 	}
 }
 
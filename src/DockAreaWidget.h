@@ -85,6 +85,14 @@ protected:
 	 */
 	void insertDockWidget(int index, CDockWidget* DockWidget, bool Activate = true);
 
+	/**
+	 * Appends the given dock widgets as tabs in one pass. The tab bar
+	 * signals are blocked once and the minimum size hint and the title bar
+	 * buttons are updated once for all dock widgets. The last open dock
+	 * widget becomes the current one. Used by CDockManager::addDockWidgets().
+	 */
+	void appendDockWidgets(const QList<CDockWidget*>& DockWidgets);
+
 	/**
 	 * Add a new dock widget to dock area.
 	 * All dockwidgets in the dock area tabified in a stacked layout with tabs
@@ -125,6 +133,12 @@ protected:
 	 */
 	void updateTitleBarVisibility();
 
+	/**
+	 * Called by the dock container if a layout change transaction is
+	 * committed to apply the deferred title bar updates
+	 */
+	void commitLayoutChange();
+
 	/**
 	 * This is the internal private function for setting the current widget.
 	 * This function is called by the public setCurrentDockWidget() function
@@ -137,6 +151,13 @@ protected:
 	 */
 	void markTitleBarMenuOutdated();
 
+	/**
+	 * Geometry changes of a dock area invalidate the layout model of the
+	 * dock container
+	 */
+	virtual void resizeEvent(QResizeEvent* event) override;
+	virtual void moveEvent(QMoveEvent* event) override;
+
 protected slots:
 	void toggleView(bool Open);
 
@@ -12,6 +12,10 @@
 
 #include <memory>
 
+#include <QCoreApplication>
+#include <QList>
+#include <QPointer>
+
 #include "DockWidgetTab.h"
 #include "DockAreaTabBar.h"
 #include "DockAreaTitleBar.h"
@@ -21,15 +25,79 @@
 namespace ads
 {
 static std::unique_ptr<CDockComponentsFactory> DefaultFactory(new CDockComponentsFactory());
+static QList<QPointer<CDockWidgetTab>> DockWidgetTabPool;
+static int DockWidgetTabPoolSize = 0;
+
+
+//============================================================================
+static void clearDockWidgetTabPool()
+{
+	for (auto Tab : DockWidgetTabPool)
+	{
+		delete Tab.data();
+	}
+	DockWidgetTabPool.clear();
+}
 
 
 //============================================================================
 CDockWidgetTab* CDockComponentsFactory::createDockWidgetTab(CDockWidget* DockWidget) const
 {
+	while (!DockWidgetTabPool.isEmpty())
+	{
+		CDockWidgetTab* Tab = DockWidgetTabPool.takeLast();
+		if (Tab)
+		{
+			Tab->setDockWidget(DockWidget);
+			return Tab;
+		}
+	}
+
 	return new CDockWidgetTab(DockWidget);
 }
 
 
+//============================================================================
+void CDockComponentsFactory::recycleDockWidgetTab(CDockWidgetTab* Tab) const
+{
+	if (DockWidgetTabPool.count() >= DockWidgetTabPoolSize)
+	{
+		return;
+	}
+
+	// The pooled tabs have no parent. The application owns the pool and
+	// deletes the remaining tabs when it is destroyed
+	static bool PostRoutineAdded = false;
+	if (!PostRoutineAdded)
+	{
+		qAddPostRoutine(clearDockWidgetTabPool);
+		PostRoutineAdded = true;
+	}
+
+	Tab->hide();
+	Tab->setParent(nullptr);
+	DockWidgetTabPool.append(Tab);
+}
+
+
+//============================================================================
+void CDockComponentsFactory::setDockWidgetTabPoolSize(int Size)
+{
+	DockWidgetTabPoolSize = qMax(0, Size);
+	while (DockWidgetTabPool.count() > DockWidgetTabPoolSize)
+	{
+		delete DockWidgetTabPool.takeLast().data();
+	}
+}
+
+
+//============================================================================
+int CDockComponentsFactory::dockWidgetTabPoolSize()
+{
+	return DockWidgetTabPoolSize;
+}
+
+
 //============================================================================
 CDockAreaTabBar* CDockComponentsFactory::createDockAreaTabBar(CDockAreaWidget* DockArea) const
 {
@@ -54,6 +122,8 @@ const CDockComponentsFactory* CDockComponentsFactory::factory()
 //============================================================================
 void CDockComponentsFactory::setFactory(CDockComponentsFactory* Factory)
 {
+	// Recycled tabs may have been created by the previous factory
+	clearDockWidgetTabPool();
 	DefaultFactory.reset(Factory);
 }
 
@@ -61,6 +131,7 @@ void CDockComponentsFactory::setFactory(CDockComponentsFactory* Factory)
 //============================================================================
 void CDockComponentsFactory::resetDefaultFactory()
 {
+	clearDockWidgetTabPool();
 	DefaultFactory.reset(new CDockComponentsFactory());
 }
 } // namespace ads
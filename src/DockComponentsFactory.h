@@ -41,11 +41,36 @@ public:
 	virtual ~CDockComponentsFactory() {}
 
 	/**
-	 * This default implementation just creates a dock widget tab with
-	 * new CDockWidgetTab(DockWIdget).
+	 * This default implementation creates a dock widget tab with
+	 * new CDockWidgetTab(DockWIdget). If tab recycling is enabled and a
+	 * recycled tab is available, the recycled tab is assigned to the
+	 * given dock widget instead.
 	 */
 	virtual CDockWidgetTab* createDockWidgetTab(CDockWidget* DockWidget) const;
 
+	/**
+	 * This function is called if a dock widget that owns the given tab is
+	 * deleted. If the tab pool is not full, the default implementation
+	 * removes the tab from the dock widget and keeps it for reuse in
+	 * createDockWidgetTab(). Otherwise the tab is deleted together with
+	 * its dock widget.
+	 * If you override createDockWidgetTab() without calling the base class
+	 * implementation, you should override this function, too.
+	 */
+	virtual void recycleDockWidgetTab(CDockWidgetTab* Tab) const;
+
+	/**
+	 * Sets the maximum number of recycled dock widget tabs that are kept
+	 * for reuse. The default value is 0 - that means, tab recycling is
+	 * disabled.
+	 */
+	static void setDockWidgetTabPoolSize(int Size);
+
+	/**
+	 * Returns the maximum number of recycled dock widget tabs
+	 */
+	static int dockWidgetTabPoolSize();
+
 	/**
 	 * This default implementation just creates a dock area tab bar with
 	 * new CDockAreaTabBar(DockArea).
@@ -70,7 +95,8 @@ public:
 	static void setFactory(CDockComponentsFactory* Factory);
 
 	/**
-	 * Resets the current factory to the
+	 * Resets the current factory to the default factory.
+	 * Setting a new factory deletes all recycled dock widget tabs.
 	 */
 	static void resetDefaultFactory();
 };
@@ -32,23 +32,32 @@
 
 #include <QEvent>
 #include <QList>
+#include <QVector>
 #include <QGridLayout>
 #include <QPointer>
 #include <QVariant>
 #include <QDebug>
 #include <QXmlStreamWriter>
 #include <QAbstractButton>
+#include <QTimer>
+#include <QSet>
 
 #include "DockManager.h"
 #include "DockAreaWidget.h"
+#include "DockAreaTitleBar.h"
 #include "DockWidget.h"
 #include "DockingStateReader.h"
 #include "FloatingDockContainer.h"
 #include "DockOverlay.h"
 #include "ads_globals.h"
 #include "DockSplitter.h"
+#include "DockTrace.h"
+#include "DockLayoutModel.h"
+#include "DockLayoutSnapshot.h"
 
+#include <algorithm>
 #include <functional>
+#include <numeric>
 #include <iostream>
 
 #if QT_VERSION < 0x050900
@@ -121,6 +130,44 @@ static void insertWidgetIntoSplitter(QSplitter* Splitter, QWidget* widget, bool
 	}
 }
 
+/**
+ * Name of the dynamic splitter property that stores the proportional sizes
+ * of a restored splitter until they are applied
+ */
+static const char* const PendingSplitterRatiosProperty = "PendingSplitterRatios";
+
+/**
+ * Returns the proportional sizes of the given splitter. If the splitter
+ * has pending ratios from a restored state, the pending ratios are returned
+ */
+static QVector<double> splitterRatios(QSplitter* Splitter)
+{
+	QVariant PendingRatios = Splitter->property(PendingSplitterRatiosProperty);
+	if (PendingRatios.isValid())
+	{
+		return PendingRatios.value<QVector<double>>();
+	}
+
+	QVector<double> Ratios;
+	auto Sizes = Splitter->sizes();
+	double Total = std::accumulate(Sizes.begin(), Sizes.end(), 0);
+	for (auto Size : Sizes)
+	{
+		Ratios.append((Total > 0) ? Size / Total : 0.0);
+	}
+	return Ratios;
+}
+
+/**
+ * Dock area that has been toggled during a layout change transaction
+ */
+struct ToggledDockArea
+{
+	QPointer<CDockAreaWidget> DockArea;
+	bool WasVisible;
+};
+
+
 /**
  * Private data class of CDockContainerWidget class (pimpl)
  */
@@ -137,6 +184,14 @@ public:
 	CDockAreaWidget* LastAddedAreaCache[5];
 	int VisibleDockAreaCount = -1;
 	CDockAreaWidget* TopLevelDockArea = nullptr;
+	bool DockAreasAddedPending = false;
+	bool DockAreasRemovedPending = false;
+	bool SplitterNormalizationPending = false;
+	bool SplitterSizesPending = false;
+	QVector<ToggledDockArea> ToggledDockAreas;
+	CDockLayoutModel LayoutModel;
+	QVector<CDockAreaWidget*> LayoutModelAreas;
+	bool LayoutModelDirty = true;
 
 	/**
 	 * Private data constructor
@@ -281,25 +336,131 @@ public:
 	 */
 	void onVisibleDockAreaCountChanged();
 
+	/**
+	 * Returns true, if the dock manager has an open layout change
+	 * transaction
+	 */
+	bool isLayoutChangeActive() const
+	{
+		return DockManager && DockManager->isLayoutChangeActive();
+	}
+
+	/**
+	 * Schedules the normalization of the splitter tree. The normalization
+	 * runs once in the next event loop iteration. So many topology changes
+	 * are normalized together and no splitter is deleted while a caller
+	 * still uses it.
+	 */
+	void scheduleSplitterNormalization();
+
+	/**
+	 * Merges child splitters with the same orientation like the given
+	 * splitter into the given splitter and replaces child splitters with
+	 * only one child by this child. The sizes of the merged widgets are
+	 * scaled to the size of the replaced child splitter.
+	 */
+	void normalizeSplitter(QSplitter* Splitter);
+
+	/**
+	 * Normalizes the complete splitter tree including the root splitter
+	 */
+	void normalizeSplitters();
+
+	/**
+	 * Applies the pending proportional splitter sizes of a restored state
+	 * to the complete splitter tree in one single pass. Does nothing if the
+	 * container is not visible or has no valid geometry yet
+	 */
+	void applyPendingSplitterSizes();
+
+	/**
+	 * Recursively applies the pending ratios of the given splitter and its
+	 * child splitters. The available size of each child splitter is
+	 * calculated from the sizes assigned to its parent, so no layout pass
+	 * is required between the levels
+	 */
+	void applySplitterRatios(QSplitter* Splitter, const QSize& Size);
+
+	/**
+	 * Rebuilds the layout model from the splitter tree if it is outdated
+	 */
+	void updateLayoutModel();
+
+	/**
+	 * Adds the nodes for all child widgets of the given splitter to the
+	 * layout model node Parent
+	 */
+	void addLayoutModelNodes(int Parent, QSplitter* Splitter);
+
+	/**
+	 * Returns the statistics of the dock manager or a nullptr if statistics
+	 * are disabled
+	 */
+	CDockManagerStatistics* statistics() const
+	{
+		return DockManager ? DockManager->mutableStatistics() : nullptr;
+	}
+
+	/**
+	 * Counts one layout mutation if statistics are enabled
+	 */
+	void countLayoutMutation()
+	{
+		auto Statistics = statistics();
+		if (Statistics)
+		{
+			Statistics->LayoutMutationCount++;
+		}
+	}
+
 	void emitDockAreasRemoved()
 	{
+		countLayoutMutation();
+		LayoutModelDirty = true;
+		scheduleSplitterNormalization();
+		if (isLayoutChangeActive())
+		{
+			DockAreasRemovedPending = true;
+			return;
+		}
 		onVisibleDockAreaCountChanged();
 		emit _this->dockAreasRemoved();
 	}
 
 	void emitDockAreasAdded()
 	{
+		countLayoutMutation();
+		LayoutModelDirty = true;
+		scheduleSplitterNormalization();
+		if (isLayoutChangeActive())
+		{
+			DockAreasAddedPending = true;
+			return;
+		}
 		onVisibleDockAreaCountChanged();
 		emit _this->dockAreasAdded();
 	}
 
+	/**
+	 * Recomputes the derived state and emits the signals deferred during
+	 * a layout change transaction
+	 */
+	void commitLayoutChange();
+
 	/**
 	 * Helper function for creation of new splitter
 	 */
 	CDockSplitter* newSplitter(Qt::Orientation orientation, QWidget* parent = nullptr)
 	{
 		CDockSplitter* s = new CDockSplitter(orientation, parent);
-		s->setOpaqueResize(CDockManager::configFlags().testFlag(CDockManager::OpaqueSplitterResize));
+		if (CDockManager::testConfigFlag(CDockManager::LiveSplitterResize))
+		{
+			s->setLiveResizeInterval(CDockManager::liveSplitterResizeInterval());
+		}
+		else
+		{
+			s->setOpaqueResize(CDockManager::configFlags().testFlag(CDockManager::OpaqueSplitterResize));
+		}
 		s->setChildrenCollapsible(false);
 		return s;
 	}
@@ -310,6 +471,20 @@ public:
 	{
 		CDockAreaWidget* DockArea = qobject_cast<CDockAreaWidget*>(_this->sender());
 		VisibleDockAreaCount += Visible ? 1 : -1;
+		countLayoutMutation();
+		LayoutModelDirty = true;
+		if (isLayoutChangeActive())
+		{
+			// Only the visibility before the first toggle is recorded. The
+			// signal is emitted on commit if the final visibility differs
+			auto it = std::find_if(ToggledDockAreas.begin(), ToggledDockAreas.end(),
+				[DockArea](const ToggledDockArea& Entry) { return Entry.DockArea == DockArea; });
+			if (it == ToggledDockAreas.end())
+			{
+				ToggledDockAreas.append({DockArea, !Visible});
+			}
+			return;
+		}
 		onVisibleDockAreaCountChanged();
 		emit _this->dockAreaViewToggled(DockArea, Visible);
 	}
@@ -372,18 +547,308 @@ void DockContainerWidgetPrivate::onVisibleDockAreaCountChanged()
 	if (TopLevelDockArea)
 	{
 		this->TopLevelDockArea = TopLevelDockArea;
-		TopLevelDockArea->titleBarButton(TitleBarButtonUndock)->setVisible(false || !_this->isFloating());
-		TopLevelDockArea->titleBarButton(TitleBarButtonClose)->setVisible(false || !_this->isFloating());
+		TopLevelDockArea->titleBar()->setButtonVisible(TitleBarButtonUndock, false || !_this->isFloating());
+		TopLevelDockArea->titleBar()->setButtonVisible(TitleBarButtonClose, false || !_this->isFloating());
 	}
 	else if (this->TopLevelDockArea)
 	{
-		this->TopLevelDockArea->titleBarButton(TitleBarButtonUndock)->setVisible(true);
-		this->TopLevelDockArea->titleBarButton(TitleBarButtonClose)->setVisible(true);
+		this->TopLevelDockArea->titleBar()->setButtonVisible(TitleBarButtonUndock, true);
+		this->TopLevelDockArea->titleBar()->setButtonVisible(TitleBarButtonClose, true);
 		this->TopLevelDockArea = nullptr;
 	}
 }
 
 
+//============================================================================
+void DockContainerWidgetPrivate::scheduleSplitterNormalization()
+{
+	if (SplitterNormalizationPending)
+	{
+		return;
+	}
+
+	SplitterNormalizationPending = true;
+	QTimer::singleShot(0, _this, [this]()
+	{
+		normalizeSplitters();
+	});
+}
+
+
+//============================================================================
+void DockContainerWidgetPrivate::normalizeSplitter(QSplitter* Splitter)
+{
+	for (int i = 0; i < Splitter->count(); ++i)
+	{
+		CDockSplitter* ChildSplitter = qobject_cast<CDockSplitter*>(Splitter->widget(i));
+		if (!ChildSplitter)
+		{
+			continue;
+		}
+
+		normalizeSplitter(ChildSplitter);
+		if (ChildSplitter->count() > 1
+		 && ChildSplitter->orientation() != Splitter->orientation())
+		{
+			continue;
+		}
+
+		// A hidden splitter with visible content would make its content
+		// visible if we merge it
+		if (ChildSplitter->isHidden() && ChildSplitter->hasVisibleContent())
+		{
+			continue;
+		}
+
+		// The child widgets share the space of the child splitter in the
+		// same ratio like before
+		auto Sizes = Splitter->sizes();
+		auto ChildSizes = ChildSplitter->sizes();
+		int ChildSize = Sizes.takeAt(i);
+		int ChildTotal = std::accumulate(ChildSizes.begin(), ChildSizes.end(), 0);
+		int Remaining = ChildSize;
+		for (int j = 0; j < ChildSizes.count(); ++j)
+		{
+			int Size = (j == ChildSizes.count() - 1) ? Remaining
+				: (ChildTotal > 0 ? qint64(ChildSizes[j]) * ChildSize / ChildTotal : 0);
+			Remaining -= Size;
+			Sizes.insert(i + j, Size);
+		}
+
+		QList<QWidget*> Widgets;
+		for (int j = 0; j < ChildSplitter->count(); ++j)
+		{
+			Widgets.append(ChildSplitter->widget(j));
+		}
+		for (int j = 0; j < Widgets.count(); ++j)
+		{
+			Splitter->insertWidget(i + j, Widgets[j]);
+		}
+		delete ChildSplitter;
+
+		if (ChildSize > 0 && ChildTotal > 0)
+		{
+			Splitter->setSizes(Sizes);
+		}
+
+		// The merged widgets may be splitters that can be merged now, so
+		// we check the same index again
+		--i;
+	}
+}
+
+
+//============================================================================
+void DockContainerWidgetPrivate::normalizeSplitters()
+{
+	SplitterNormalizationPending = false;
+	// Merging splitters would drop pending ratios - the normalization is
+	// scheduled again when the pending sizes have been applied
+	if (!RootSplitter || SplitterSizesPending)
+	{
+		return;
+	}
+
+	LayoutModelDirty = true;
+	normalizeSplitter(RootSplitter);
+
+	// A root splitter with only one child splitter is replaced by this
+	// child splitter
+	while (RootSplitter->count() == 1)
+	{
+		QSplitter* ChildSplitter = qobject_cast<QSplitter*>(RootSplitter->widget(0));
+		if (!ChildSplitter)
+		{
+			break;
+		}
+
+		QSplitter* OldRoot = RootSplitter;
+		ChildSplitter->setParent(nullptr);
+		QLayoutItem* li = Layout->replaceWidget(OldRoot, ChildSplitter);
+		RootSplitter = ChildSplitter;
+		delete li;
+		delete OldRoot;
+	}
+}
+
+
+//============================================================================
+void DockContainerWidgetPrivate::applyPendingSplitterSizes()
+{
+	QSize Size = _this->contentsRect().size();
+	if (!RootSplitter || !_this->isVisible() || Size.isEmpty())
+	{
+		return;
+	}
+
+	SplitterSizesPending = false;
+	applySplitterRatios(RootSplitter, Size);
+	scheduleSplitterNormalization();
+}
+
+
+//============================================================================
+void DockContainerWidgetPrivate::applySplitterRatios(QSplitter* Splitter,
+	const QSize& Size)
+{
+	QVariant PendingRatios = Splitter->property(PendingSplitterRatiosProperty);
+	Splitter->setProperty(PendingSplitterRatiosProperty, QVariant());
+	bool Horizontal = (Splitter->orientation() == Qt::Horizontal);
+	QList<int> Sizes;
+	auto Ratios = PendingRatios.value<QVector<double>>();
+	if (PendingRatios.isValid() && Ratios.count() == Splitter->count())
+	{
+		int VisibleCount = 0;
+		for (int i = 0; i < Splitter->count(); ++i)
+		{
+			VisibleCount += Splitter->widget(i)->isHidden() ? 0 : 1;
+		}
+		int Length = Horizontal ? Size.width() : Size.height();
+		Length -= Splitter->handleWidth() * qMax(0, VisibleCount - 1);
+		for (auto Ratio : Ratios)
+		{
+			Sizes.append(qRound(Ratio * Length));
+		}
+		Splitter->setSizes(Sizes);
+	}
+	else
+	{
+		Sizes = Splitter->sizes();
+	}
+
+	for (int i = 0; i < Splitter->count(); ++i)
+	{
+		QSplitter* ChildSplitter = qobject_cast<QSplitter*>(Splitter->widget(i));
+		if (ChildSplitter)
+		{
+			applySplitterRatios(ChildSplitter, Horizontal
+				? QSize(Sizes[i], Size.height()) : QSize(Size.width(), Sizes[i]));
+		}
+	}
+}
+
+
+//============================================================================
+void DockContainerWidgetPrivate::updateLayoutModel()
+{
+	if (!LayoutModelDirty)
+	{
+		return;
+	}
+
+	LayoutModelDirty = false;
+	LayoutModel.clear();
+	LayoutModelAreas.clear();
+	if (!RootSplitter)
+	{
+		return;
+	}
+
+	auto& Root = LayoutModel.node(LayoutModel.rootNode());
+	Root.Orientation = RootSplitter->orientation();
+	Root.Geometry = QRect(RootSplitter->mapTo(_this, QPoint(0, 0)), RootSplitter->size());
+	Root.Visible = !RootSplitter->isHidden();
+	addLayoutModelNodes(LayoutModel.rootNode(), RootSplitter);
+}
+
+
+//============================================================================
+void DockContainerWidgetPrivate::addLayoutModelNodes(int Parent, QSplitter* Splitter)
+{
+	auto Sizes = Splitter->sizes();
+	for (int i = 0; i < Splitter->count(); ++i)
+	{
+		QWidget* Widget = Splitter->widget(i);
+		QSplitter* ChildSplitter = qobject_cast<QSplitter*>(Widget);
+		CDockAreaWidget* DockArea = qobject_cast<CDockAreaWidget*>(Widget);
+		int Index;
+		if (ChildSplitter)
+		{
+			Index = LayoutModel.addSplitter(Parent, ChildSplitter->orientation(), Sizes[i]);
+		}
+		else if (DockArea)
+		{
+			QStringList DockWidgetNames;
+			for (auto DockWidget : DockArea->dockWidgets())
+			{
+				DockWidgetNames.append(DockWidget->objectName());
+				LayoutModel.setDockWidgetClosed(DockWidget->objectName(), DockWidget->isClosed());
+			}
+			Index = LayoutModel.addArea(Parent, DockWidgetNames, Sizes[i]);
+			auto CurrentDockWidget = DockArea->currentDockWidget();
+			LayoutModel.node(Index).CurrentDockWidget = CurrentDockWidget
+				? CurrentDockWidget->objectName() : QString();
+			if (LayoutModelAreas.count() <= Index)
+			{
+				LayoutModelAreas.resize(Index + 1);
+			}
+			LayoutModelAreas[Index] = DockArea;
+		}
+		else
+		{
+			continue;
+		}
+
+		auto& Node = LayoutModel.node(Index);
+		Node.Geometry = QRect(Widget->mapTo(_this, QPoint(0, 0)), Widget->size());
+		Node.Visible = !Widget->isHidden();
+		if (ChildSplitter)
+		{
+			addLayoutModelNodes(Index, ChildSplitter);
+		}
+	}
+}
+
+
+//============================================================================
+void DockContainerWidgetPrivate::commitLayoutChange()
+{
+	// Batched changes may bypass the functions that mark the layout model
+	// as outdated, and the model holds raw dock area pointers
+	LayoutModelDirty = true;
+	// Count the visible dock areas once instead of tracking each change
+	VisibleDockAreaCount = -1;
+	onVisibleDockAreaCountChanged();
+	for (auto DockArea : DockAreas)
+	{
+		DockArea->commitLayoutChange();
+	}
+
+	// Reset the pending state before emitting, because connected slots may
+	// start a new layout change
+	bool Removed = DockAreasRemovedPending;
+	bool Added = DockAreasAddedPending;
+	auto Toggled = ToggledDockAreas;
+	DockAreasRemovedPending = false;
+	DockAreasAddedPending = false;
+	ToggledDockAreas.clear();
+
+	if (Removed)
+	{
+		emit _this->dockAreasRemoved();
+	}
+
+	if (Added)
+	{
+		emit _this->dockAreasAdded();
+	}
+
+	for (const auto& Entry : Toggled)
+	{
+		if (!Entry.DockArea || !DockAreas.contains(Entry.DockArea))
+		{
+			continue;
+		}
+
+		bool Visible = !Entry.DockArea->isHidden();
+		if (Visible != Entry.WasVisible)
+		{
+			emit _this->dockAreaViewToggled(Entry.DockArea, Visible);
+		}
+	}
+}
+
+
 //============================================================================
 void DockContainerWidgetPrivate::dropIntoContainer(CFloatingDockContainer* FloatingWidget,
 	DockWidgetArea area)
@@ -722,8 +1187,8 @@ void DockContainerWidgetPrivate::addDockAreasToList(const QList<CDockAreaWidget*
 	// likely hidden. We need to ensure, that it is visible
 	for (auto DockArea : NewDockAreas)
 	{
-		DockArea->titleBarButton(TitleBarButtonUndock)->setVisible(true);
-		DockArea->titleBarButton(TitleBarButtonClose)->setVisible(true);
+		DockArea->titleBar()->setButtonVisible(TitleBarButtonUndock, true);
+		DockArea->titleBar()->setButtonVisible(TitleBarButtonClose, true);
 	}
 
 	// We need to ensure, that the dock area title bar is visible. The title bar
@@ -778,6 +1243,15 @@ void DockContainerWidgetPrivate::saveChildNodesState(QXmlStreamWriter& s, QWidge
 				s.writeCharacters(QString::number(Size) + " ");
 			}
 			s.writeEndElement();
+
+			// The proportional sizes do not depend on the screen size and
+			// allow to apply the sizes before the final geometry is known
+			s.writeStartElement("Ratios");
+			for (auto Ratio : splitterRatios(Splitter))
+			{
+				s.writeCharacters(QString::number(Ratio, 'g', 6) + " ");
+			}
+			s.writeEndElement();
 		s.writeEndElement();
 	}
 	else
@@ -830,6 +1304,7 @@ bool DockContainerWidgetPrivate::restoreSplitter(CDockingStateReader& s,
 	}
 	bool Visible = false;
 	QList<int> Sizes;
+	QVector<double> Ratios;
 	while (s.readNextStartElement())
 	{
 		QWidget* ChildNode = nullptr;
@@ -854,6 +1329,17 @@ bool DockContainerWidgetPrivate::restoreSplitter(CDockingStateReader& s,
 				Sizes.append(value);
 			}
 		}
+		else if (s.name() == "Ratios")
+		{
+			QString sRatios = s.readElementText().trimmed();
+			QTextStream TextStream(&sRatios);
+			while (!TextStream.atEnd())
+			{
+				double value;
+				TextStream >> value;
+				Ratios.append(value);
+			}
+		}
 		else
 		{
 			s.skipCurrentElement();
@@ -889,7 +1375,18 @@ bool DockContainerWidgetPrivate::restoreSplitter(CDockingStateReader& s,
 		}
 		else
 		{
-			Splitter->setSizes(Sizes);
+			// Ratios are optional because older states do not contain them
+			if (Ratios.count() == WidgetCount
+			 && CDockManager::testConfigFlag(CDockManager::DeferredSplitterSizes))
+			{
+				Splitter->setProperty(PendingSplitterRatiosProperty,
+					QVariant::fromValue(Ratios));
+				SplitterSizesPending = true;
+			}
+			else
+			{
+				Splitter->setSizes(Sizes);
+			}
 			Splitter->setVisible(Visible);
 		}
 		CreatedWidget = Splitter;
@@ -920,12 +1417,9 @@ bool DockContainerWidgetPrivate::restoreDockArea(CDockingStateReader& s,
     ADS_PRINT("Restore NodeDockArea Tabs: " << Tabs << " Current: "
             << CurrentDockWidget);
 
+	// The dock area is created when the first dock widget of the area is
+	// found. Areas that only contain unknown dock widgets are never created
 	CDockAreaWidget* DockArea = nullptr;
-	if (!Testing)
-	{
-		DockArea = new CDockAreaWidget(DockManager, _this);
-	}
-
 	while (s.readNextStartElement())
 	{
 		if (s.name() != "Widget")
@@ -953,9 +1447,13 @@ bool DockContainerWidgetPrivate::restoreDockArea(CDockingStateReader& s,
 		}
 
         ADS_PRINT("Dock Widget found - parent " << DockWidget->parent());
-		// We hide the DockArea here to prevent the short display (the flashing)
-		// of the dock areas during application startup
-		DockArea->hide();
+		if (!DockArea)
+		{
+			DockArea = new CDockAreaWidget(DockManager, _this);
+			// We hide the DockArea here to prevent the short display (the flashing)
+			// of the dock areas during application startup
+			DockArea->hide();
+		}
 		DockArea->addDockWidget(DockWidget);
 		DockWidget->setToggleViewActionChecked(!Closed);
 		DockWidget->setClosedState(Closed);
@@ -968,12 +1466,7 @@ bool DockContainerWidgetPrivate::restoreDockArea(CDockingStateReader& s,
 		return true;
 	}
 
-	if (!DockArea->dockWidgetsCount())
-	{
-		delete DockArea;
-		DockArea = nullptr;
-	}
-	else
+	if (DockArea)
 	{
 		DockArea->setProperty("currentDockWidget", CurrentDockWidget);
 		appendDockAreas({DockArea});
@@ -1247,6 +1740,18 @@ bool CDockContainerWidget::isInFrontOf(CDockContainerWidget* Other) const
 bool CDockContainerWidget::event(QEvent *e)
 {
 	bool Result = QWidget::event(e);
+	switch (e->type())
+	{
+	case QEvent::Show:
+	case QEvent::Resize:
+	case QEvent::LayoutRequest:
+		d->LayoutModelDirty = true;
+		break;
+
+	default:
+		break;
+	}
+
 	if (e->type() == QEvent::WindowActivate)
     {
         d->zOrderIndex = ++zOrderCounter;
@@ -1256,6 +1761,14 @@ bool CDockContainerWidget::event(QEvent *e)
 		d->zOrderIndex = ++zOrderCounter;
 	}
 
+	// Pending splitter sizes of a restored state are applied as soon as the
+	// first real geometry is known
+	if (d->SplitterSizesPending
+	 && (e->type() == QEvent::Show || e->type() == QEvent::Resize))
+	{
+		d->applyPendingSplitterSizes();
+	}
+
 	return Result;
 }
 
@@ -1341,28 +1854,209 @@ void CDockContainerWidget::removeDockArea(CDockAreaWidget* area)
 	delete Splitter;
 
 emitAndExit:
-	CDockWidget* TopLevelWidget = topLevelDockWidget();
-
 	// Updated the title bar visibility of the dock widget if there is only
-    // one single visible dock widget
-	CDockWidget::emitTopLevelEventForWidget(TopLevelWidget, true);
+    // one single visible dock widget. In a layout change transaction, this
+	// is done once on commit
+	if (!d->isLayoutChangeActive())
+	{
+		CDockWidget* TopLevelWidget = topLevelDockWidget();
+		CDockWidget::emitTopLevelEventForWidget(TopLevelWidget, true);
+	}
 	dumpLayout();
 	d->emitDockAreasRemoved();
 }
 
 
+//============================================================================
+void CDockContainerWidget::normalizeSplitterTree()
+{
+	d->normalizeSplitters();
+}
+
+
+//============================================================================
+int CDockContainerWidget::splitterTreeDepth() const
+{
+	return d->RootSplitter ? layoutModel().splitterTreeDepth() : 0;
+}
+
+
+//============================================================================
+int CDockContainerWidget::splitterCount() const
+{
+	return d->RootSplitter ? layoutModel().splitterCount() : 0;
+}
+
+
+//============================================================================
+void CDockContainerWidget::commitLayoutChange()
+{
+	d->commitLayoutChange();
+}
+
+
 //============================================================================
 CDockAreaWidget* CDockContainerWidget::dockAreaAt(const QPoint& GlobalPos) const
 {
-	for (const auto& DockArea : d->DockAreas)
+	if (!isVisible())
 	{
-		if (DockArea->isVisible() && DockArea->rect().contains(DockArea->mapFromGlobal(GlobalPos)))
+		return nullptr;
+	}
+
+	int Index = layoutModel().areaAt(mapFromGlobal(GlobalPos));
+	return (Index >= 0 && Index < d->LayoutModelAreas.count())
+		? d->LayoutModelAreas[Index] : nullptr;
+}
+
+
+//============================================================================
+const CDockLayoutModel& CDockContainerWidget::layoutModel() const
+{
+	d->updateLayoutModel();
+	return d->LayoutModel;
+}
+
+
+//============================================================================
+/**
+ * Adds the given layout model node and all its child nodes to the snapshot.
+ * Origin is the global position of the container.
+ */
+static void addSnapshotNodes(const CDockLayoutModel& Model, int Index,
+	int Parent, int Position, const QPoint& Origin, CDockContainerSnapshot& Snapshot)
+{
+	const auto& Node = Model.node(Index);
+	if (CDockLayoutNode::AreaNode == Node.Type)
+	{
+		CDockAreaSnapshot Area;
+		Area.Parent = Parent;
+		Area.Position = Position;
+		Area.DockWidgets = Node.DockWidgets;
+		for (const auto& DockWidget : Node.DockWidgets)
 		{
-			return DockArea;
+			Area.OpenFlags.append(!Model.isDockWidgetClosed(DockWidget));
 		}
+		Area.CurrentIndex = Node.DockWidgets.indexOf(Node.CurrentDockWidget);
+		Area.Geometry = Node.Geometry.translated(Origin);
+		Area.Visible = Node.Visible;
+		Snapshot.Areas.append(Area);
+		return;
+	}
+
+	CDockSplitterSnapshot Splitter;
+	Splitter.Parent = Parent;
+	Splitter.Position = Position;
+	Splitter.Orientation = Node.Orientation;
+	for (auto Child : Node.Children)
+	{
+		Splitter.Sizes.append(Model.node(Child).Size);
+	}
+	Splitter.Geometry = Node.Geometry.translated(Origin);
+	Splitter.Visible = Node.Visible;
+	int SplitterIndex = Snapshot.Splitters.count();
+	Snapshot.Splitters.append(Splitter);
+	for (int i = 0; i < Node.Children.count(); ++i)
+	{
+		addSnapshotNodes(Model, Node.Children[i], SplitterIndex, i, Origin, Snapshot);
 	}
+}
+
 
-	return nullptr;
+//============================================================================
+CDockContainerSnapshot CDockContainerWidget::layoutSnapshot() const
+{
+	CDockContainerSnapshot Snapshot;
+	auto FloatingWidget = floatingWidget();
+	Snapshot.Floating = (FloatingWidget != nullptr);
+	if (FloatingWidget)
+	{
+		Snapshot.FloatingGeometry = FloatingWidget->geometry();
+	}
+	Snapshot.ZOrder = zOrderIndex();
+	QPoint Origin = mapToGlobal(QPoint(0, 0));
+	Snapshot.Geometry = QRect(Origin, size());
+	Snapshot.Visible = isVisible();
+
+	const auto& Model = layoutModel();
+	addSnapshotNodes(Model, Model.rootNode(), -1, 0, Origin, Snapshot);
+	return Snapshot;
+}
+
+
+//============================================================================
+/**
+ * Adds the given object and all its children to the object counts of the
+ * container footprint. The subtrees of the objects in Exclude and of all
+ * dock widgets are skipped. The pooled dock widgets are not registered in
+ * the dock manager, so they are skipped by their type
+ */
+static void addToFootprint(QObject* Object, const QSet<QObject*>& Exclude,
+	CDockContainerFootprint& Footprint)
+{
+	if (Exclude.contains(Object) || qobject_cast<CDockWidget*>(Object))
+	{
+		return;
+	}
+
+	Footprint.ObjectCount++;
+	Footprint.WidgetCount += Object->isWidgetType() ? 1 : 0;
+	for (auto Child : Object->children())
+	{
+		addToFootprint(Child, Exclude, Footprint);
+	}
+}
+
+
+//============================================================================
+CDockContainerFootprint CDockContainerWidget::containerFootprint() const
+{
+	CDockContainerFootprint Footprint;
+	Footprint.DockAreaCount = d->DockAreas.count();
+	Footprint.PrivateDataBytes = sizeof(DockContainerWidgetPrivate);
+
+	// The dock widgets and their tabs are reported via their own footprint.
+	// Lean dock widgets may not have a tab yet - it must not be created here
+	QSet<QObject*> Exclude;
+	for (auto DockWidget : dockWidgets())
+	{
+		Footprint.DockWidgetCount++;
+		Footprint.DockWidgets += DockWidget->footprint();
+		Exclude.insert(DockWidget);
+		if (auto TabWidget = DockWidget->existingTabWidget())
+		{
+			Exclude.insert(TabWidget);
+		}
+	}
+
+	// The floating widgets are children of the dock manager but have their
+	// own footprint. Closed dock widgets without dock area are reparented
+	// to the dock manager. The dock manager reports them separately
+	QObject* Root = const_cast<CDockContainerWidget*>(this);
+	if (isFloating())
+	{
+		Root = floatingWidget();
+	}
+	else if (d->DockManager.data() == this)
+	{
+		for (auto FloatingWidget : d->DockManager->floatingWidgets())
+		{
+			Exclude.insert(FloatingWidget);
+		}
+		for (auto DockWidget : d->DockManager->dockWidgetsMap())
+		{
+			Exclude.insert(DockWidget);
+		}
+	}
+
+	addToFootprint(Root, Exclude, Footprint);
+	return Footprint;
+}
+
+
+//============================================================================
+void CDockContainerWidget::markLayoutModelDirty()
+{
+	d->LayoutModelDirty = true;
 }
 
 
@@ -1409,6 +2103,9 @@ void CDockContainerWidget::dropFloatingWidget(CFloatingDockContainer* FloatingWi
 	const QPoint& TargetPos)
 {
     ADS_PRINT("CDockContainerWidget::dropFloatingWidget");
+	ADS_TRACE_SCOPE("DockContainerWidget::dropFloatingWidget");
+	auto Statistics = d->statistics();
+	internal::CScopedTiming Timing(Statistics ? &Statistics->Drop : nullptr);
 	CDockWidget* SingleDroppedDockWidget = FloatingWidget->topLevelDockWidget();
 	CDockWidget* SingleDockWidget = topLevelDockWidget();
 	CDockAreaWidget* DockArea = dockAreaAt(TargetPos);
@@ -1465,6 +2162,9 @@ void CDockContainerWidget::dropFloatingWidget(CFloatingDockContainer* FloatingWi
 //============================================================================
 void CDockContainerWidget::dropWidget(QWidget* Widget, DockWidgetArea DropArea, CDockAreaWidget* TargetAreaWidget)
 {
+	ADS_TRACE_SCOPE("DockContainerWidget::dropWidget");
+	auto Statistics = d->statistics();
+	internal::CScopedTiming Timing(Statistics ? &Statistics->Drop : nullptr);
     CDockWidget* SingleDockWidget = topLevelDockWidget();
 	if (TargetAreaWidget)
 	{
@@ -1577,6 +2277,14 @@ bool CDockContainerWidget::restoreState(CDockingStateReader& s, bool Testing)
 	QSplitter* OldRoot = d->RootSplitter;
 	d->RootSplitter = qobject_cast<QSplitter*>(NewRootSplitter);
 	OldRoot->deleteLater();
+	d->LayoutModelDirty = true;
+	d->scheduleSplitterNormalization();
+	// If the container is already visible, then the event handler will not
+	// see a show event
+	if (d->SplitterSizesPending)
+	{
+		d->applyPendingSplitterSizes();
+	}
 
 	return true;
 }
@@ -1703,6 +2411,10 @@ CFloatingDockContainer* CDockContainerWidget::floatingWidget() const
 //============================================================================
 void CDockContainerWidget::closeOtherAreas(CDockAreaWidget* KeepOpenArea)
 {
+	// We collect the dock widgets of all areas and close them in one batch
+	// to avoid the intermediate layouts
+	QList<CDockWidget*> CloseDockWidgets;
+	QList<CDockWidget*> HideDockWidgets;
 	for (const auto DockArea : d->DockAreas)
 	{
 		if (DockArea == KeepOpenArea)
@@ -1721,8 +2433,19 @@ void CDockContainerWidget::closeOtherAreas(CDockAreaWidget* KeepOpenArea)
 			continue;
 		}
 
-		DockArea->closeArea();
+		// This is the same logic like in CDockAreaWidget::closeArea()
+		auto OpenDockWidgets = DockArea->openedDockWidgets();
+		if (OpenDockWidgets.count() == 1 && OpenDockWidgets[0]->features().testFlag(CDockWidget::DockWidgetDeleteOnClose))
+		{
+			CloseDockWidgets.append(OpenDockWidgets[0]);
+		}
+		else
+		{
+			HideDockWidgets.append(OpenDockWidgets);
+		}
 	}
+
+	d->DockManager->closeDockWidgetsInternal(CloseDockWidgets, HideDockWidgets);
 }
 
 
@@ -50,6 +50,26 @@ struct FloatingDockContainerPrivate;
 class CFloatingDragPreview;
 struct FloatingDragPreviewPrivate;
 class CDockingStateReader;
+class CDockLayoutModel;
+struct CDockContainerSnapshot;
+
+/**
+ * Approximate memory footprint of a dock container.
+ * The object counts contain the dock areas, title bars, splitters and all
+ * other objects the docking system created for the container. The dock
+ * widgets and their tabs are not included in the object counts. Their
+ * footprints are summed up in DockWidgets.
+ */
+struct CDockContainerFootprint
+{
+	int DockWidgetCount = 0; ///< dock widgets in the container
+	int DockAreaCount = 0; ///< dock areas in the container
+	int ObjectCount = 0; ///< QObjects of the container without the dock widgets
+	int WidgetCount = 0; ///< QWidgets among the counted objects
+	int PrivateDataBytes = 0; ///< heap bytes of the container private data
+	CDockWidgetFootprint DockWidgets; ///< sum of the footprints of all dock widgets
+};
+
 
 /**
  * Container that manages a number of dock areas with single dock widgets
@@ -155,6 +175,26 @@ protected:
      */
     QList<CDockWidget*> dockWidgets() const;
 
+	/**
+	 * Called by the dock manager if the outermost layout change transaction
+	 * is closed. Recomputes the derived state of all dock areas once and
+	 * emits the signals that have been deferred during the transaction.
+	 */
+	void commitLayoutChange();
+
+	/**
+	 * Marks the layout model as outdated. The model is rebuilt from the
+	 * splitter tree on the next access.
+	 */
+	void markLayoutModelDirty();
+
+	/**
+	 * Returns a snapshot of the layout of this container.
+	 * Use CDockManager::snapshotLayout() to get the snapshot of all
+	 * containers.
+	 */
+	CDockContainerSnapshot layoutSnapshot() const;
+
 public:
 	/**
 	 * Default Constructor
@@ -223,6 +263,42 @@ public:
 	 */
 	int dockAreaCount() const;
 
+	/**
+	 * Merges nested splitters with the same orientation and removes
+	 * splitters that contain only one single widget. The container
+	 * schedules this normalization automatically after each change of the
+	 * splitter tree and after restoring the state. Call this function if
+	 * you need a normalized tree immediately.
+	 */
+	void normalizeSplitterTree();
+
+	/**
+	 * Returns the depth of the splitter tree of this container. A container
+	 * with only a root splitter has a depth of 1.
+	 */
+	int splitterTreeDepth() const;
+
+	/**
+	 * Returns the number of splitters in the splitter tree of this
+	 * container
+	 */
+	int splitterCount() const;
+
+	/**
+	 * Returns the headless model of the layout of this container.
+	 * The container keeps the model in sync with its splitter tree and uses
+	 * it for topology queries and hit testing. Copy the model to simulate
+	 * layout changes without creating any widgets.
+	 */
+	const CDockLayoutModel& layoutModel() const;
+
+	/**
+	 * Returns the approximate memory footprint of this container and of all
+	 * dock widgets in it. For a floating container, the floating widget and
+	 * its title bar are included in the object counts.
+	 */
+	CDockContainerFootprint containerFootprint() const;
+
 	/**
 	 * Returns the number of visible dock areas
 	 */
@@ -0,0 +1,513 @@
+/*******************************************************************************
+** Qt Advanced Docking System
+** Copyright (C) 2017 Uwe Kindler
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 2.1 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+
+//============================================================================
+/// \file   DockFrameTimeObserver.cpp
+/// \author Uwe Kindler
+/// \date   19.10.2026
+/// \brief  Implementation of CDockFrameTimeObserver class
+//============================================================================
+
+
+//============================================================================
+//                                   INCLUDES
+//============================================================================
+#include "DockFrameTimeObserver.h"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QMouseEvent>
+#include <QSplitterHandle>
+#include <QVector>
+
+#include <algorithm>
+
+#include "DockManager.h"
+#include "DockWidget.h"
+#include "DockWidgetTab.h"
+#include "DockAreaTitleBar.h"
+#include "DockContainerWidget.h"
+#include "DockSplitter.h"
+#include "DockOverlay.h"
+#include "FloatingDockContainer.h"
+
+
+namespace ads
+{
+/**
+ * Posted to the observer to end a frame after other events have been
+ * delivered. If Repainted is false, the event is posted when the frame
+ * begins with a priority below the priority of the update requests. If the
+ * frame has not seen a repaint when it arrives, the input event did not
+ * repaint any affected widget. If Repainted is true, the event is posted
+ * when the first update request or paint event of an affected widget is
+ * delivered, so it arrives after the painting has finished.
+ */
+class CFrameEndEvent : public QEvent
+{
+public:
+	static QEvent::Type eventType()
+	{
+		static const QEvent::Type Type = static_cast<QEvent::Type>(QEvent::registerEventType());
+		return Type;
+	}
+
+	int Frame;
+	bool Repainted;
+
+	CFrameEndEvent(int Frame, bool Repainted) : QEvent(eventType()),
+		Frame(Frame), Repainted(Repainted) {}
+};
+
+
+/**
+ * Private data class of CDockFrameTimeObserver class (pimpl)
+ */
+struct DockFrameTimeObserverPrivate
+{
+	CDockFrameTimeObserver* _this;
+	CDockManager* DockManager;
+	bool Enabled = false;
+	bool InteractionActive = false;
+	eDockInteraction Interaction = TabDragInteraction;
+	QElapsedTimer InteractionTimer;
+	QElapsedTimer FrameTimer;
+	bool FramePending = false;
+	bool RepaintPending = false;
+	bool FinishPending = false;
+	int MoveCount = 0;
+	int FrameSerial = 0;
+	QVector<qint64> FrameNsecs;
+
+	/**
+	 * Private data constructor
+	 */
+	DockFrameTimeObserverPrivate(CDockFrameTimeObserver* _public);
+
+	/**
+	 * Returns true, if the given widget belongs to the dock manager or to
+	 * one of its floating containers
+	 */
+	bool isManagedWidget(QWidget* Widget) const;
+
+	/**
+	 * Returns true, if the repaint of the given widget shows the result of
+	 * an input event. These are the widgets of the dock manager and of the
+	 * floating containers, their windows and the drop overlays.
+	 */
+	bool isAffectedWidget(QWidget* Widget) const;
+
+	/**
+	 * Returns the interaction that a mouse press on the given widget starts.
+	 * Returns false, if a press on the widget does not start a measured
+	 * interaction.
+	 */
+	bool interactionFor(QWidget* Widget, eDockInteraction& Result) const;
+
+	/**
+	 * Starts a new interaction
+	 */
+	void beginInteraction(eDockInteraction NewInteraction);
+
+	/**
+	 * Starts a frame for an input event if no frame is pending. The frame
+	 * completes after the next update request or paint event of an affected
+	 * widget has been delivered.
+	 */
+	void beginFrame();
+
+	/**
+	 * Called if an update request or paint event of an affected widget is
+	 * about to be delivered. The frame completes when the posted
+	 * CFrameEndEvent arrives after the delivery.
+	 */
+	void repaintFrame();
+
+	/**
+	 * Records the time of the pending frame
+	 */
+	void completeFrame();
+
+	/**
+	 * Drops the pending frame without recording it. This is called if the
+	 * input event did not repaint any affected widget.
+	 */
+	void discardFrame();
+
+	/**
+	 * Computes the percentiles and emits the interactionFinished() signal
+	 */
+	void finishInteraction();
+};
+// struct DockFrameTimeObserverPrivate
+
+
+//============================================================================
+DockFrameTimeObserverPrivate::DockFrameTimeObserverPrivate(CDockFrameTimeObserver* _public) :
+	_this(_public)
+{
+
+}
+
+
+//============================================================================
+bool DockFrameTimeObserverPrivate::isManagedWidget(QWidget* Widget) const
+{
+	if (Widget == DockManager || DockManager->isAncestorOf(Widget))
+	{
+		return true;
+	}
+
+	for (auto FloatingWidget : DockManager->floatingWidgets())
+	{
+		if (Widget == FloatingWidget || FloatingWidget->isAncestorOf(Widget))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+
+//============================================================================
+bool DockFrameTimeObserverPrivate::isAffectedWidget(QWidget* Widget) const
+{
+	if (qobject_cast<CDockOverlay*>(Widget) || qobject_cast<CDockOverlayCross*>(Widget))
+	{
+		return true;
+	}
+
+	// Update requests are sent to the window of the dock manager
+	return (Widget == DockManager->window()) || isManagedWidget(Widget);
+}
+
+
+//============================================================================
+bool DockFrameTimeObserverPrivate::interactionFor(QWidget* Widget,
+	eDockInteraction& Result) const
+{
+	// The walk stops at the dock widgets and containers, so presses in the
+	// content of a dock widget do not start an interaction
+	for (auto w = Widget; w; w = w->parentWidget())
+	{
+		if (qobject_cast<CDockWidgetTab*>(w))
+		{
+			Result = TabDragInteraction;
+			return true;
+		}
+		else if (qobject_cast<CDockAreaTitleBar*>(w))
+		{
+			Result = TitleBarDragInteraction;
+			return true;
+		}
+		else if (qobject_cast<CFloatingDockContainer*>(w))
+		{
+			Result = FloatingMoveInteraction;
+			return true;
+		}
+
+		QSplitterHandle* Handle = qobject_cast<QSplitterHandle*>(w);
+		if (Handle && qobject_cast<CDockSplitter*>(Handle->splitter()))
+		{
+			Result = SplitterDragInteraction;
+			return true;
+		}
+
+		if (qobject_cast<CDockWidget*>(w) || qobject_cast<CDockContainerWidget*>(w)
+		 || w->isWindow())
+		{
+			return false;
+		}
+	}
+	return false;
+}
+
+
+//============================================================================
+void DockFrameTimeObserverPrivate::beginInteraction(eDockInteraction NewInteraction)
+{
+	InteractionActive = true;
+	Interaction = NewInteraction;
+	FramePending = false;
+	FinishPending = false;
+	MoveCount = 0;
+	FrameNsecs.clear();
+	InteractionTimer.start();
+}
+
+
+//============================================================================
+void DockFrameTimeObserverPrivate::beginFrame()
+{
+	if (FramePending)
+	{
+		return;
+	}
+
+	FramePending = true;
+	RepaintPending = false;
+	FrameTimer.start();
+	// The widgets post their update requests with Qt::LowEventPriority, so
+	// they are delivered before this event
+	QCoreApplication::postEvent(_this, new CFrameEndEvent(++FrameSerial, false),
+		Qt::LowEventPriority - 1);
+}
+
+
+//============================================================================
+void DockFrameTimeObserverPrivate::repaintFrame()
+{
+	if (!FramePending || RepaintPending)
+	{
+		return;
+	}
+
+	// The event filter runs before the repaint, so the frame ends with an
+	// event that is posted now and delivered after the painting
+	RepaintPending = true;
+	QCoreApplication::postEvent(_this, new CFrameEndEvent(FrameSerial, true));
+}
+
+
+//============================================================================
+void DockFrameTimeObserverPrivate::completeFrame()
+{
+	if (!FramePending)
+	{
+		return;
+	}
+
+	FramePending = false;
+	RepaintPending = false;
+	FrameNsecs.append(FrameTimer.nsecsElapsed());
+	if (FinishPending)
+	{
+		finishInteraction();
+	}
+}
+
+
+//============================================================================
+void DockFrameTimeObserverPrivate::discardFrame()
+{
+	if (!FramePending)
+	{
+		return;
+	}
+
+	FramePending = false;
+	if (FinishPending)
+	{
+		finishInteraction();
+	}
+}
+
+
+//============================================================================
+void DockFrameTimeObserverPrivate::finishInteraction()
+{
+	InteractionActive = false;
+	FinishPending = false;
+	if (!MoveCount || FrameNsecs.isEmpty())
+	{
+		return;
+	}
+
+	CDockInteractionFrameTimes FrameTimes;
+	FrameTimes.Interaction = Interaction;
+	FrameTimes.FrameCount = FrameNsecs.count();
+	FrameTimes.DurationNsecs = InteractionTimer.nsecsElapsed();
+	std::sort(FrameNsecs.begin(), FrameNsecs.end());
+	// Nearest rank percentiles
+	auto Percentile = [this](int P)
+	{
+		int Rank = (P * FrameNsecs.count() + 99) / 100;
+		return FrameNsecs[qMax(Rank, 1) - 1];
+	};
+	FrameTimes.MedianNsecs = Percentile(50);
+	FrameTimes.P90Nsecs = Percentile(90);
+	FrameTimes.P99Nsecs = Percentile(99);
+	FrameTimes.MaxNsecs = FrameNsecs.last();
+	FrameNsecs.clear();
+	emit _this->interactionFinished(FrameTimes);
+}
+
+
+//============================================================================
+CDockFrameTimeObserver::CDockFrameTimeObserver(CDockManager* DockManager) :
+	Super(DockManager),
+	d(new DockFrameTimeObserverPrivate(this))
+{
+	d->DockManager = DockManager;
+	qRegisterMetaType<CDockInteractionFrameTimes>();
+}
+
+
+//============================================================================
+CDockFrameTimeObserver::~CDockFrameTimeObserver()
+{
+	setEnabled(false);
+	delete d;
+}
+
+
+//============================================================================
+void CDockFrameTimeObserver::setEnabled(bool Enabled)
+{
+	if (d->Enabled == Enabled)
+	{
+		return;
+	}
+
+	d->Enabled = Enabled;
+	d->InteractionActive = false;
+	d->FramePending = false;
+	d->RepaintPending = false;
+	auto Application = QCoreApplication::instance();
+	if (!Application)
+	{
+		return;
+	}
+
+	if (Enabled)
+	{
+		Application->installEventFilter(this);
+	}
+	else
+	{
+		Application->removeEventFilter(this);
+	}
+}
+
+
+//============================================================================
+bool CDockFrameTimeObserver::isEnabled() const
+{
+	return d->Enabled;
+}
+
+
+//============================================================================
+QString CDockFrameTimeObserver::interactionName(eDockInteraction Interaction)
+{
+	switch (Interaction)
+	{
+	case TabDragInteraction: return QStringLiteral("Tab drag");
+	case TitleBarDragInteraction: return QStringLiteral("Title bar drag");
+	case FloatingMoveInteraction: return QStringLiteral("Floating move");
+	case SplitterDragInteraction: return QStringLiteral("Splitter drag");
+	}
+	return QString();
+}
+
+
+//============================================================================
+bool CDockFrameTimeObserver::eventFilter(QObject* watched, QEvent* event)
+{
+	// Propagated mouse events pass the filter once for each receiver, so
+	// each event type is only handled once per interaction state
+	switch (event->type())
+	{
+	case QEvent::MouseButtonPress:
+	case QEvent::NonClientAreaMouseButtonPress:
+		{
+			QWidget* Widget = qobject_cast<QWidget*>(watched);
+			eDockInteraction Interaction;
+			if (!d->InteractionActive && Widget
+			 && static_cast<QMouseEvent*>(event)->button() == Qt::LeftButton
+			 && d->interactionFor(Widget, Interaction) && d->isManagedWidget(Widget))
+			{
+				d->beginInteraction(Interaction);
+			}
+		}
+		break;
+
+	case QEvent::MouseMove:
+	case QEvent::NonClientAreaMouseMove:
+		if (d->InteractionActive && !d->FinishPending)
+		{
+			d->MoveCount++;
+			d->beginFrame();
+		}
+		break;
+
+	case QEvent::Move:
+		// Native title bars do not deliver mouse moves while the window
+		// is moved, so the move events of the window are the input events
+		if (d->InteractionActive && !d->FinishPending
+		 && FloatingMoveInteraction == d->Interaction
+		 && qobject_cast<CFloatingDockContainer*>(watched))
+		{
+			d->MoveCount++;
+			d->beginFrame();
+		}
+		break;
+
+	case QEvent::MouseButtonRelease:
+	case QEvent::NonClientAreaMouseButtonRelease:
+		if (d->InteractionActive && !d->FinishPending)
+		{
+			d->FinishPending = true;
+			d->beginFrame();
+		}
+		break;
+
+	case QEvent::UpdateRequest:
+	case QEvent::Paint:
+		// The first repaint of an affected window or widget ends the frame
+		if (d->FramePending && !d->RepaintPending && watched->isWidgetType()
+		 && d->isAffectedWidget(static_cast<QWidget*>(watched)))
+		{
+			d->repaintFrame();
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	return Super::eventFilter(watched, event);
+}
+
+
+//============================================================================
+void CDockFrameTimeObserver::customEvent(QEvent* event)
+{
+	if (event->type() == CFrameEndEvent::eventType())
+	{
+		// Events of earlier frames are ignored
+		auto FrameEndEvent = static_cast<CFrameEndEvent*>(event);
+		bool CurrentFrame = (FrameEndEvent->Frame == d->FrameSerial);
+		if (CurrentFrame && FrameEndEvent->Repainted)
+		{
+			d->completeFrame();
+		}
+		else if (CurrentFrame && !d->RepaintPending)
+		{
+			d->discardFrame();
+		}
+	}
+	Super::customEvent(event);
+}
+
+} // namespace ads
+
+//---------------------------------------------------------------------------
+// EOF DockFrameTimeObserver.cpp
@@ -0,0 +1,148 @@
+#ifndef DockFrameTimeObserverH
+#define DockFrameTimeObserverH
+/*******************************************************************************
+** Qt Advanced Docking System
+** Copyright (C) 2017 Uwe Kindler
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 2.1 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+
+//============================================================================
+/// \file   DockFrameTimeObserver.h
+/// \author Uwe Kindler
+/// \date   19.10.2026
+/// \brief  Declaration of CDockFrameTimeObserver class
+//============================================================================
+
+
+//============================================================================
+//                                   INCLUDES
+//============================================================================
+#include <QObject>
+#include <QMetaType>
+
+#include "ads_globals.h"
+
+namespace ads
+{
+class CDockManager;
+struct DockFrameTimeObserverPrivate;
+
+/**
+ * The docking interactions measured by CDockFrameTimeObserver
+ */
+enum eDockInteraction
+{
+	TabDragInteraction,       //!< dragging a dock widget tab
+	TitleBarDragInteraction,  //!< dragging a dock area title bar
+	FloatingMoveInteraction,  //!< moving a floating container via its title bar
+	SplitterDragInteraction   //!< dragging a splitter handle of a dock container
+};
+
+
+/**
+ * Frame time results of one finished docking interaction.
+ * All times are given in nanoseconds.
+ */
+struct CDockInteractionFrameTimes
+{
+	eDockInteraction Interaction = TabDragInteraction;
+	int FrameCount = 0; ///< number of measured frames
+	qint64 DurationNsecs = 0; ///< time from the mouse press to the last completed frame
+	qint64 MedianNsecs = 0; ///< 50th percentile of the frame times
+	qint64 P90Nsecs = 0; ///< 90th percentile of the frame times
+	qint64 P99Nsecs = 0; ///< 99th percentile of the frame times
+	qint64 MaxNsecs = 0; ///< longest frame time
+};
+
+
+/**
+ * Measures the frame times of docking interactions like tab drags, title
+ * bar drags, floating container moves and splitter drags.
+ * For each input event of an interaction, the observer measures the time
+ * until the first update request or paint event of an affected window -
+ * the window of the dock manager, a floating container or a drop overlay -
+ * has been delivered, so the frame time includes the painting.
+ * Input events that arrive while a frame is pending belong to this frame.
+ * Input events that do not repaint any affected window are not counted as
+ * frames. The release of the mouse button is measured as the last frame,
+ * so it includes the drop.
+ * At the end of each interaction, the observer emits interactionFinished()
+ * with the percentiles of the frame times.
+ *
+ * The observer is disabled by default. If enabled, it installs an
+ * application wide event filter, so it should only be enabled for
+ * measurements - i.e. in CI runs on the offscreen platform:
+ * \code
+ * auto Observer = DockManager->frameTimeObserver();
+ * Observer->setEnabled(true);
+ * QObject::connect(Observer, &ads::CDockFrameTimeObserver::interactionFinished,
+ *     [](const ads::CDockInteractionFrameTimes& FrameTimes) {...});
+ * \endcode
+ */
+class ADS_EXPORT CDockFrameTimeObserver : public QObject
+{
+	Q_OBJECT
+private:
+	DockFrameTimeObserverPrivate* d; ///< private data (pimpl)
+	friend struct DockFrameTimeObserverPrivate;
+
+protected:
+	virtual bool eventFilter(QObject* watched, QEvent* event) override;
+	virtual void customEvent(QEvent* event) override;
+
+public:
+	using Super = QObject;
+
+	/**
+	 * Creates the observer for the given dock manager.
+	 * Use CDockManager::frameTimeObserver() to get the observer of a
+	 * dock manager.
+	 */
+	CDockFrameTimeObserver(CDockManager* DockManager);
+
+	/**
+	 * Virtual Destructor
+	 */
+	virtual ~CDockFrameTimeObserver();
+
+	/**
+	 * Enables or disables the observer
+	 */
+	void setEnabled(bool Enabled);
+
+	/**
+	 * Returns true, if the observer is enabled
+	 */
+	bool isEnabled() const;
+
+	/**
+	 * Returns a readable name of the given interaction - i.e. for reports
+	 */
+	static QString interactionName(eDockInteraction Interaction);
+
+signals:
+	/**
+	 * This signal is emitted at the end of each interaction with at least
+	 * one measured mouse move
+	 */
+	void interactionFinished(const ads::CDockInteractionFrameTimes& FrameTimes);
+}; // class DockFrameTimeObserver
+} // namespace ads
+
+Q_DECLARE_METATYPE(ads::CDockInteractionFrameTimes)
+
+//---------------------------------------------------------------------------
+#endif // DockFrameTimeObserverH
@@ -0,0 +1,637 @@
+/*******************************************************************************
+** Qt Advanced Docking System
+** Copyright (C) 2017 Uwe Kindler
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 2.1 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+
+//============================================================================
+/// \file   DockLayoutModel.cpp
+/// \author Uwe Kindler
+/// \date   19.10.2026
+/// \brief  Implementation of CDockLayoutModel class
+//============================================================================
+
+
+//============================================================================
+//                                   INCLUDES
+//============================================================================
+#include "DockLayoutModel.h"
+
+#include <QPair>
+#include <QXmlStreamWriter>
+
+
+namespace ads
+{
+/**
+ * Parent index of nodes that have been removed from the tree. The nodes
+ * are dropped by the next compact() call
+ */
+static const int DetachedNode = -2;
+
+
+//============================================================================
+CDockLayoutModel::CDockLayoutModel()
+{
+	clear();
+}
+
+
+//============================================================================
+void CDockLayoutModel::clear()
+{
+	Nodes.clear();
+	ClosedDockWidgets.clear();
+	CDockLayoutNode Root;
+	Root.Type = CDockLayoutNode::SplitterNode;
+	Nodes.append(Root);
+}
+
+
+//============================================================================
+bool CDockLayoutModel::isEmpty() const
+{
+	return !areaCount();
+}
+
+
+//============================================================================
+int CDockLayoutModel::nodeCount() const
+{
+	return Nodes.count();
+}
+
+
+//============================================================================
+const CDockLayoutNode& CDockLayoutModel::node(int Index) const
+{
+	return Nodes.at(Index);
+}
+
+
+//============================================================================
+CDockLayoutNode& CDockLayoutModel::node(int Index)
+{
+	return Nodes[Index];
+}
+
+
+//============================================================================
+int CDockLayoutModel::appendNode(const CDockLayoutNode& Node)
+{
+	Nodes.append(Node);
+	auto& Appended = Nodes.last();
+	Appended.Parent = DetachedNode;
+	Appended.Children.clear();
+	return Nodes.count() - 1;
+}
+
+
+//============================================================================
+void CDockLayoutModel::attachNode(int Parent, int Position, int Index)
+{
+	auto& Children = Nodes[Parent].Children;
+	if (Position < 0 || Position > Children.count())
+	{
+		Position = Children.count();
+	}
+	Children.insert(Position, Index);
+	Nodes[Index].Parent = Parent;
+}
+
+
+//============================================================================
+void CDockLayoutModel::detachNode(int Index)
+{
+	int Parent = Nodes[Index].Parent;
+	if (Parent >= 0)
+	{
+		Nodes[Parent].Children.removeOne(Index);
+	}
+	Nodes[Index].Parent = DetachedNode;
+}
+
+
+//============================================================================
+int CDockLayoutModel::addSplitter(int Parent, Qt::Orientation Orientation, int Size)
+{
+	CDockLayoutNode Node;
+	Node.Type = CDockLayoutNode::SplitterNode;
+	Node.Orientation = Orientation;
+	Node.Size = Size;
+	int Index = appendNode(Node);
+	attachNode(Parent, -1, Index);
+	return Index;
+}
+
+
+//============================================================================
+int CDockLayoutModel::addArea(int Parent, const QStringList& DockWidgets, int Size)
+{
+	CDockLayoutNode Node;
+	Node.Type = CDockLayoutNode::AreaNode;
+	Node.DockWidgets = DockWidgets;
+	Node.CurrentDockWidget = DockWidgets.isEmpty() ? QString() : DockWidgets.first();
+	Node.Size = Size;
+	int Index = appendNode(Node);
+	attachNode(Parent, -1, Index);
+	return Index;
+}
+
+
+//============================================================================
+void CDockLayoutModel::setDockWidgetClosed(const QString& DockWidget, bool Closed)
+{
+	if (Closed)
+	{
+		ClosedDockWidgets.insert(DockWidget);
+	}
+	else
+	{
+		ClosedDockWidgets.remove(DockWidget);
+	}
+}
+
+
+//============================================================================
+bool CDockLayoutModel::isDockWidgetClosed(const QString& DockWidget) const
+{
+	return ClosedDockWidgets.contains(DockWidget);
+}
+
+
+//============================================================================
+int CDockLayoutModel::areaCount() const
+{
+	int Count = 0;
+	for (const auto& Node : Nodes)
+	{
+		if (Node.Type == CDockLayoutNode::AreaNode && Node.Parent != DetachedNode)
+		{
+			++Count;
+		}
+	}
+	return Count;
+}
+
+
+//============================================================================
+int CDockLayoutModel::dockWidgetCount() const
+{
+	int Count = 0;
+	for (const auto& Node : Nodes)
+	{
+		if (Node.Parent != DetachedNode)
+		{
+			Count += Node.DockWidgets.count();
+		}
+	}
+	return Count;
+}
+
+
+//============================================================================
+int CDockLayoutModel::splitterCount() const
+{
+	int Count = 0;
+	for (const auto& Node : Nodes)
+	{
+		if (Node.Type == CDockLayoutNode::SplitterNode && Node.Parent != DetachedNode)
+		{
+			++Count;
+		}
+	}
+	return Count;
+}
+
+
+//============================================================================
+int CDockLayoutModel::depth(int Index) const
+{
+	int Depth = 1;
+	for (auto Child : Nodes[Index].Children)
+	{
+		if (Nodes[Child].Type == CDockLayoutNode::SplitterNode)
+		{
+			Depth = qMax(Depth, depth(Child) + 1);
+		}
+	}
+	return Depth;
+}
+
+
+//============================================================================
+int CDockLayoutModel::splitterTreeDepth() const
+{
+	return depth(rootNode());
+}
+
+
+//============================================================================
+int CDockLayoutModel::areaOf(const QString& DockWidget) const
+{
+	for (int i = 0; i < Nodes.count(); ++i)
+	{
+		const auto& Node = Nodes[i];
+		if (Node.Parent != DetachedNode && Node.DockWidgets.contains(DockWidget))
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+
+//============================================================================
+bool CDockLayoutModel::isVisible(int Index) const
+{
+	for (; Index >= 0; Index = Nodes[Index].Parent)
+	{
+		if (!Nodes[Index].Visible)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+
+//============================================================================
+int CDockLayoutModel::areaAt(const QPoint& Pos) const
+{
+	for (int i = 0; i < Nodes.count(); ++i)
+	{
+		const auto& Node = Nodes[i];
+		if (Node.Type == CDockLayoutNode::AreaNode && Node.Parent != DetachedNode
+		 && Node.Geometry.contains(Pos) && isVisible(i))
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+
+//============================================================================
+QStringList CDockLayoutModel::dockWidgets() const
+{
+	QStringList Result;
+	QVector<int> Stack{rootNode()};
+	while (!Stack.isEmpty())
+	{
+		const auto& Node = Nodes[Stack.takeLast()];
+		Result += Node.DockWidgets;
+		for (int i = Node.Children.count() - 1; i >= 0; --i)
+		{
+			Stack.append(Node.Children[i]);
+		}
+	}
+	return Result;
+}
+
+
+//============================================================================
+int CDockLayoutModel::childSizes(int Index) const
+{
+	int Result = 0;
+	for (auto Child : Nodes[Index].Children)
+	{
+		Result += Nodes[Child].Size;
+	}
+	return Result;
+}
+
+
+//============================================================================
+void CDockLayoutModel::layoutNode(int Index, const QRect& Rect)
+{
+	Nodes[Index].Geometry = Rect;
+	const auto Children = Nodes[Index].Children;
+	bool Horizontal = (Nodes[Index].Orientation == Qt::Horizontal);
+	int VisibleCount = 0;
+	int TotalSize = 0;
+	for (auto Child : Children)
+	{
+		if (Nodes[Child].Visible)
+		{
+			++VisibleCount;
+			TotalSize += Nodes[Child].Size;
+		}
+	}
+
+	int Extent = Horizontal ? Rect.width() : Rect.height();
+	int Pos = 0;
+	int Remaining = VisibleCount;
+	for (auto Child : Children)
+	{
+		if (!Nodes[Child].Visible)
+		{
+			layoutNode(Child, QRect());
+			continue;
+		}
+
+		// The last visible child gets the rest to compensate rounding errors
+		--Remaining;
+		int ChildExtent;
+		if (!Remaining)
+		{
+			ChildExtent = Extent - Pos;
+		}
+		else if (TotalSize > 0)
+		{
+			ChildExtent = int(qint64(Nodes[Child].Size) * Extent / TotalSize);
+		}
+		else
+		{
+			ChildExtent = Extent / VisibleCount;
+		}
+
+		QRect ChildRect = Horizontal
+			? QRect(Rect.left() + Pos, Rect.top(), ChildExtent, Rect.height())
+			: QRect(Rect.left(), Rect.top() + Pos, Rect.width(), ChildExtent);
+		Pos += ChildExtent;
+		layoutNode(Child, ChildRect);
+	}
+}
+
+
+//============================================================================
+void CDockLayoutModel::setGeometry(const QRect& Rect)
+{
+	layoutNode(rootNode(), Rect);
+}
+
+
+//============================================================================
+void CDockLayoutModel::removeDockWidgetFromArea(int Area, const QString& DockWidget)
+{
+	auto& Node = Nodes[Area];
+	Node.DockWidgets.removeOne(DockWidget);
+	if (Node.CurrentDockWidget == DockWidget)
+	{
+		Node.CurrentDockWidget = Node.DockWidgets.isEmpty()
+			? QString() : Node.DockWidgets.first();
+	}
+
+	if (!Node.DockWidgets.isEmpty())
+	{
+		return;
+	}
+
+	// Remove the empty area and all splitters that become empty. The root
+	// splitter always stays in the tree
+	int Parent = Node.Parent;
+	detachNode(Area);
+	while (Parent > 0 && Nodes[Parent].Children.isEmpty())
+	{
+		int Next = Nodes[Parent].Parent;
+		detachNode(Parent);
+		Parent = Next;
+	}
+}
+
+
+//============================================================================
+void CDockLayoutModel::insertArea(int Target, CDockLayoutNode& Area,
+	Qt::Orientation Orientation, bool Append)
+{
+	int Parent = Nodes[Target].Parent;
+	int Position = Nodes[Parent].Children.indexOf(Target);
+	int TargetSize = Nodes[Target].Size;
+	if (Nodes[Parent].Orientation == Orientation || Nodes[Parent].Children.count() == 1)
+	{
+		Nodes[Parent].Orientation = Orientation;
+		Area.Size = TargetSize / 2;
+		Nodes[Target].Size = TargetSize - Area.Size;
+		attachNode(Parent, Append ? Position + 1 : Position, appendNode(Area));
+		return;
+	}
+
+	// The target gets replaced by a new splitter with the required
+	// orientation that contains the target and the new area
+	CDockLayoutNode Splitter;
+	Splitter.Type = CDockLayoutNode::SplitterNode;
+	Splitter.Orientation = Orientation;
+	Splitter.Size = TargetSize;
+	Splitter.Visible = Nodes[Target].Visible;
+	int NewSplitter = appendNode(Splitter);
+	detachNode(Target);
+	attachNode(Parent, Position, NewSplitter);
+	Area.Size = TargetSize / 2;
+	Nodes[Target].Size = TargetSize - Area.Size;
+	attachNode(NewSplitter, -1, Target);
+	attachNode(NewSplitter, Append ? -1 : 0, appendNode(Area));
+}
+
+
+//============================================================================
+void CDockLayoutModel::insertAreaIntoRoot(CDockLayoutNode& Area,
+	Qt::Orientation Orientation, bool Append)
+{
+	int Root = rootNode();
+	if (Nodes[Root].Children.count() > 1 && Nodes[Root].Orientation != Orientation)
+	{
+		// Move the current content into a new splitter with the old
+		// orientation, so that the root can change its orientation
+		CDockLayoutNode Splitter;
+		Splitter.Type = CDockLayoutNode::SplitterNode;
+		Splitter.Orientation = Nodes[Root].Orientation;
+		Splitter.Size = childSizes(Root);
+		int NewSplitter = appendNode(Splitter);
+		const auto Children = Nodes[Root].Children;
+		for (auto Child : Children)
+		{
+			detachNode(Child);
+			attachNode(NewSplitter, -1, Child);
+		}
+		attachNode(Root, -1, NewSplitter);
+	}
+
+	Nodes[Root].Orientation = Orientation;
+	int ChildCount = Nodes[Root].Children.count();
+	Area.Size = ChildCount ? childSizes(Root) / ChildCount : 0;
+	attachNode(Root, Append ? -1 : 0, appendNode(Area));
+}
+
+
+//============================================================================
+void CDockLayoutModel::compact()
+{
+	// Renumber the nodes in depth first order. This drops the detached
+	// nodes and keeps the root at index 0
+	QVector<CDockLayoutNode> Compacted;
+	Compacted.reserve(Nodes.count());
+	QVector<QPair<int, int>> Stack{qMakePair(rootNode(), -1)};
+	while (!Stack.isEmpty())
+	{
+		auto Entry = Stack.takeLast();
+		int NewIndex = Compacted.count();
+		Compacted.append(Nodes[Entry.first]);
+		auto& Node = Compacted.last();
+		Node.Parent = Entry.second;
+		Node.Children.clear();
+		if (Entry.second >= 0)
+		{
+			Compacted[Entry.second].Children.append(NewIndex);
+		}
+
+		const auto& Children = Nodes[Entry.first].Children;
+		for (int i = Children.count() - 1; i >= 0; --i)
+		{
+			Stack.append(qMakePair(Children[i], NewIndex));
+		}
+	}
+	Nodes = Compacted;
+}
+
+
+//============================================================================
+bool CDockLayoutModel::removeDockWidget(const QString& DockWidget)
+{
+	int Area = areaOf(DockWidget);
+	if (Area < 0)
+	{
+		return false;
+	}
+
+	removeDockWidgetFromArea(Area, DockWidget);
+	ClosedDockWidgets.remove(DockWidget);
+	compact();
+	if (Nodes[rootNode()].Geometry.isValid())
+	{
+		setGeometry(Nodes[rootNode()].Geometry);
+	}
+	return true;
+}
+
+
+//============================================================================
+bool CDockLayoutModel::dropDockWidget(const QString& DockWidget,
+	DockWidgetArea DropArea, int TargetArea)
+{
+	if (TargetArea >= Nodes.count() || (TargetArea >= 0
+	 && (Nodes[TargetArea].Type != CDockLayoutNode::AreaNode
+	 || Nodes[TargetArea].Parent == DetachedNode)))
+	{
+		return false;
+	}
+
+	bool IsOuterArea = (DropArea == LeftDockWidgetArea || DropArea == RightDockWidgetArea
+		|| DropArea == TopDockWidgetArea || DropArea == BottomDockWidgetArea);
+	if (!IsOuterArea && (DropArea != CenterDockWidgetArea || TargetArea < 0))
+	{
+		return false;
+	}
+
+	int SourceArea = areaOf(DockWidget);
+	if (SourceArea >= 0 && SourceArea == TargetArea
+	 && Nodes[SourceArea].DockWidgets.count() == 1)
+	{
+		// A single dock widget can not be dropped onto its own area
+		return DropArea == CenterDockWidgetArea;
+	}
+
+	if (SourceArea >= 0)
+	{
+		removeDockWidgetFromArea(SourceArea, DockWidget);
+	}
+
+	if (DropArea == CenterDockWidgetArea)
+	{
+		Nodes[TargetArea].DockWidgets.append(DockWidget);
+		Nodes[TargetArea].CurrentDockWidget = DockWidget;
+	}
+	else
+	{
+		CDockLayoutNode Area;
+		Area.Type = CDockLayoutNode::AreaNode;
+		Area.DockWidgets.append(DockWidget);
+		Area.CurrentDockWidget = DockWidget;
+		auto Orientation = (DropArea == LeftDockWidgetArea || DropArea == RightDockWidgetArea)
+			? Qt::Horizontal : Qt::Vertical;
+		bool Append = (DropArea == RightDockWidgetArea || DropArea == BottomDockWidgetArea);
+		if (TargetArea < 0)
+		{
+			insertAreaIntoRoot(Area, Orientation, Append);
+		}
+		else
+		{
+			insertArea(TargetArea, Area, Orientation, Append);
+		}
+	}
+
+	ClosedDockWidgets.remove(DockWidget);
+	compact();
+	if (Nodes[rootNode()].Geometry.isValid())
+	{
+		setGeometry(Nodes[rootNode()].Geometry);
+	}
+	return true;
+}
+
+
+//============================================================================
+void CDockLayoutModel::saveNode(QXmlStreamWriter& s, int Index) const
+{
+	const auto& Node = Nodes[Index];
+	if (Node.Type == CDockLayoutNode::SplitterNode)
+	{
+		s.writeStartElement("Splitter");
+		s.writeAttribute("Orientation", (Node.Orientation == Qt::Horizontal) ? "|" : "-");
+		s.writeAttribute("Count", QString::number(Node.Children.count()));
+			for (auto Child : Node.Children)
+			{
+				saveNode(s, Child);
+			}
+
+			s.writeStartElement("Sizes");
+			for (auto Child : Node.Children)
+			{
+				s.writeCharacters(QString::number(Nodes[Child].Size) + " ");
+			}
+			s.writeEndElement();
+		s.writeEndElement();
+	}
+	else
+	{
+		s.writeStartElement("Area");
+		s.writeAttribute("Tabs", QString::number(Node.DockWidgets.count()));
+		s.writeAttribute("Current", Node.CurrentDockWidget);
+		for (const auto& DockWidget : Node.DockWidgets)
+		{
+			s.writeStartElement("Widget");
+			s.writeAttribute("Name", DockWidget);
+			s.writeAttribute("Closed", QString::number(isDockWidgetClosed(DockWidget) ? 1 : 0));
+			s.writeEndElement();
+		}
+		s.writeEndElement();
+	}
+}
+
+
+//============================================================================
+void CDockLayoutModel::saveState(QXmlStreamWriter& Stream) const
+{
+	Stream.writeStartElement("Container");
+	Stream.writeAttribute("Floating", "0");
+	saveNode(Stream, rootNode());
+	Stream.writeEndElement();
+}
+
+} // namespace ads
+
+//---------------------------------------------------------------------------
+// EOF DockLayoutModel.cpp
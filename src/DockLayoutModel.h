@@ -0,0 +1,235 @@
+#ifndef DockLayoutModelH
+#define DockLayoutModelH
+/*******************************************************************************
+** Qt Advanced Docking System
+** Copyright (C) 2017 Uwe Kindler
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 2.1 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+
+//============================================================================
+/// \file   DockLayoutModel.h
+/// \author Uwe Kindler
+/// \date   19.10.2026
+/// \brief  Declaration of CDockLayoutModel class
+//============================================================================
+
+
+//============================================================================
+//                                   INCLUDES
+//============================================================================
+#include "ads_globals.h"
+
+#include <QRect>
+#include <QSet>
+#include <QStringList>
+#include <QVector>
+
+QT_FORWARD_DECLARE_CLASS(QXmlStreamWriter)
+
+namespace ads
+{
+/**
+ * A single node of the layout model. A node is either a splitter node with
+ * child nodes or an area node with a list of dock widgets.
+ * Dock widgets are identified by their object name.
+ */
+struct CDockLayoutNode
+{
+	enum eType
+	{
+		SplitterNode,
+		AreaNode
+	};
+
+	eType Type = AreaNode;
+	int Parent = -1; ///< index of the parent splitter node, -1 for the root node
+	QVector<int> Children; ///< child nodes of a splitter node
+	Qt::Orientation Orientation = Qt::Horizontal; ///< layout direction of a splitter node
+	int Size = 0; ///< size in the parent splitter along the parent orientation
+	QRect Geometry; ///< geometry in container coordinates
+	bool Visible = true;
+	QStringList DockWidgets; ///< dock widgets of an area node
+	QString CurrentDockWidget; ///< current dock widget of an area node
+};
+
+
+/**
+ * Plain data model of the layout of one dock container: a tree of splitter
+ * nodes with area nodes as leaves. The root node is always a splitter node
+ * with the index 0.
+ *
+ * CDockContainerWidget keeps a model of its widget layout up to date (see
+ * CDockContainerWidget::layoutModel()) and uses it for topology queries and
+ * hit testing. The model does not depend on any widget, so it can also be
+ * used on its own to plan and validate layouts - i.e. to compute what the
+ * layout would look like after dropping a dock widget somewhere:
+ * \code
+ * ads::CDockLayoutModel Model = Container->layoutModel();
+ * Model.dropDockWidget("Properties", ads::RightDockWidgetArea, Model.areaOf("Editor"));
+ * int Depth = Model.splitterTreeDepth();
+ * \endcode
+ * The mutations follow the rules of the dock container. Node indices are
+ * not stable across mutations.
+ */
+class ADS_EXPORT CDockLayoutModel
+{
+private:
+	QVector<CDockLayoutNode> Nodes;
+	QSet<QString> ClosedDockWidgets;
+
+	int appendNode(const CDockLayoutNode& Node);
+	void attachNode(int Parent, int Position, int Index);
+	void detachNode(int Index);
+	void removeDockWidgetFromArea(int Area, const QString& DockWidget);
+	void insertArea(int Target, CDockLayoutNode& Area, Qt::Orientation Orientation, bool Append);
+	void insertAreaIntoRoot(CDockLayoutNode& Area, Qt::Orientation Orientation, bool Append);
+	void compact();
+	int childSizes(int Index) const;
+	int depth(int Index) const;
+	bool isVisible(int Index) const;
+	void layoutNode(int Index, const QRect& Rect);
+	void saveNode(QXmlStreamWriter& Stream, int Index) const;
+
+public:
+	/**
+	 * Creates an empty model that contains only the root splitter node
+	 */
+	CDockLayoutModel();
+
+	/**
+	 * Removes all nodes except the root splitter node
+	 */
+	void clear();
+
+	/**
+	 * Returns true if the model does not contain any area node
+	 */
+	bool isEmpty() const;
+
+	/**
+	 * Returns the index of the root splitter node - this is always 0
+	 */
+	int rootNode() const {return 0;}
+
+	/**
+	 * Returns the number of nodes
+	 */
+	int nodeCount() const;
+
+	/**
+	 * Returns the node with the given index
+	 */
+	const CDockLayoutNode& node(int Index) const;
+
+	/**
+	 * Returns the node with the given index for modification.
+	 * Use addSplitter() and addArea() to change the tree structure - do not
+	 * modify the Parent and Children members directly.
+	 */
+	CDockLayoutNode& node(int Index);
+
+	/**
+	 * Appends a new splitter node to the given parent splitter node and
+	 * returns its index
+	 */
+	int addSplitter(int Parent, Qt::Orientation Orientation, int Size = 0);
+
+	/**
+	 * Appends a new area node with the given dock widgets to the given
+	 * parent splitter node and returns its index
+	 */
+	int addArea(int Parent, const QStringList& DockWidgets, int Size = 0);
+
+	/**
+	 * Marks the given dock widget as closed or opened
+	 */
+	void setDockWidgetClosed(const QString& DockWidget, bool Closed);
+
+	/**
+	 * Returns true if the given dock widget is closed
+	 */
+	bool isDockWidgetClosed(const QString& DockWidget) const;
+
+	/**
+	 * Returns the number of area nodes
+	 */
+	int areaCount() const;
+
+	/**
+	 * Returns the number of dock widgets in all area nodes
+	 */
+	int dockWidgetCount() const;
+
+	/**
+	 * Returns the number of splitter nodes including the root node
+	 */
+	int splitterCount() const;
+
+	/**
+	 * Returns the maximum nesting depth of the splitter nodes. The root
+	 * node has the depth 1.
+	 */
+	int splitterTreeDepth() const;
+
+	/**
+	 * Returns the index of the area node that contains the given dock
+	 * widget or -1 if no area contains it
+	 */
+	int areaOf(const QString& DockWidget) const;
+
+	/**
+	 * Returns the index of the visible area node at the given position
+	 * in container coordinates or -1 if there is no area
+	 */
+	int areaAt(const QPoint& Pos) const;
+
+	/**
+	 * Returns the dock widgets of all area nodes in tree order
+	 */
+	QStringList dockWidgets() const;
+
+	/**
+	 * Sets the geometry of the root node and calculates the geometry of all
+	 * other nodes from their sizes
+	 */
+	void setGeometry(const QRect& Rect);
+
+	/**
+	 * Removes the given dock widget from its area. Empty areas and empty
+	 * splitters are removed. Returns false if no area contains the dock widget.
+	 */
+	bool removeDockWidget(const QString& DockWidget);
+
+	/**
+	 * Drops the given dock widget into the DropArea of the TargetArea node
+	 * or into the DropArea of the container if TargetArea is -1 - like
+	 * CDockContainerWidget::dropWidget() does. If the model already contains
+	 * the dock widget, it is moved. Returns false if the drop is not
+	 * possible.
+	 */
+	bool dropDockWidget(const QString& DockWidget, DockWidgetArea DropArea,
+		int TargetArea = -1);
+
+	/**
+	 * Writes the model as Container element in the format of
+	 * CDockContainerWidget::saveState()
+	 */
+	void saveState(QXmlStreamWriter& Stream) const;
+};
+} // namespace ads
+
+//---------------------------------------------------------------------------
+#endif // DockLayoutModelH
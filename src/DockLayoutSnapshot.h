@@ -0,0 +1,100 @@
+#ifndef DockLayoutSnapshotH
+#define DockLayoutSnapshotH
+/*******************************************************************************
+** Qt Advanced Docking System
+** Copyright (C) 2017 Uwe Kindler
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 2.1 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+
+//============================================================================
+/// \file   DockLayoutSnapshot.h
+/// \author Uwe Kindler
+/// \date   19.10.2026
+/// \brief  Declaration of the layout snapshot structures
+//============================================================================
+
+
+//============================================================================
+//                                   INCLUDES
+//============================================================================
+#include "ads_globals.h"
+
+#include <QList>
+#include <QRect>
+#include <QStringList>
+
+namespace ads
+{
+/**
+ * Snapshot of one splitter of a dock container.
+ * The splitter with the index 0 is the root splitter of the container.
+ */
+struct CDockSplitterSnapshot
+{
+	int Parent = -1; ///< index of the parent splitter, -1 for the root splitter
+	int Position = 0; ///< position in the parent splitter
+	Qt::Orientation Orientation = Qt::Horizontal;
+	QList<int> Sizes; ///< sizes of the child widgets in splitter order
+	QRect Geometry; ///< geometry in global screen coordinates
+	bool Visible = true;
+};
+
+
+/**
+ * Snapshot of one dock area of a dock container.
+ * Dock widgets are identified by their object name.
+ */
+struct CDockAreaSnapshot
+{
+	int Parent = -1; ///< index of the parent splitter
+	int Position = 0; ///< position in the parent splitter
+	QStringList DockWidgets; ///< dock widgets in tab order
+	QList<bool> OpenFlags; ///< open state of each dock widget in tab order
+	int CurrentIndex = -1; ///< index of the current dock widget
+	QRect Geometry; ///< geometry in global screen coordinates
+	bool Visible = true;
+};
+
+
+/**
+ * Snapshot of one dock container with its splitters and dock areas.
+ * The splitters and areas are stored in flat lists. The Parent and Position
+ * members of each entry describe the tree.
+ */
+struct CDockContainerSnapshot
+{
+	bool Floating = false;
+	QRect FloatingGeometry; ///< geometry of the floating widget if Floating is true
+	unsigned int ZOrder = 0; ///< z order index - higher values are in front
+	QRect Geometry; ///< geometry in global screen coordinates
+	bool Visible = true;
+	QList<CDockSplitterSnapshot> Splitters;
+	QList<CDockAreaSnapshot> Areas;
+};
+
+
+/**
+ * Snapshot of the complete layout of a dock manager.
+ * The first container is always the dock manager itself.
+ */
+struct CDockLayoutSnapshot
+{
+	QList<CDockContainerSnapshot> Containers;
+};
+} // namespace ads
+
+//---------------------------------------------------------------------------
+#endif // DockLayoutSnapshotH
@@ -33,10 +33,14 @@
 
 #include <algorithm>
 #include <iostream>
+#include <iterator>
 
 #include <QMainWindow>
 #include <QList>
 #include <QMap>
+#include <QSet>
+#include <QHash>
+#include <QPointer>
 #include <QVariant>
 #include <QDebug>
 #include <QFile>
@@ -45,6 +49,7 @@
 #include <QSettings>
 #include <QMenu>
 #include <QApplication>
+#include <QTimer>
 
 #include "FloatingDockContainer.h"
 #include "DockOverlay.h"
@@ -53,6 +58,11 @@
 #include "DockAreaWidget.h"
 #include "IconProvider.h"
 #include "DockingStateReader.h"
+#include "DockSplitter.h"
+#include "DockWidgetSearchIndex.h"
+#include "DockQuickSwitcher.h"
+#include "DockFrameTimeObserver.h"
+#include "DockTrace.h"
 
 
 /**
@@ -73,6 +83,50 @@ static void initResource()
 namespace ads
 {
 static CDockManager::ConfigFlags StaticConfigFlags = CDockManager::DefaultNonOpaqueConfig;
+static int StaticLiveSplitterResizeInterval = 33;
+
+/**
+ * Entry of the sorted action index of a view menu. The key is the case
+ * folded action text, so comparing keys gives the same order as a case
+ * insensitive compare of the action texts
+ */
+struct MenuActionEntry
+{
+	QString Key;
+	QPointer<QAction> Action;
+};
+
+/**
+ * Sorted index of the toggle view actions of a single view menu or view
+ * menu group.
+ * Pending contains the actions registered via the bulk registration
+ * function that have not been inserted into the menu yet
+ */
+struct MenuActionIndex
+{
+	QVector<MenuActionEntry> Sorted;
+	QVector<QPointer<QAction>> Pending;
+	bool FlushOnShow = false;
+};
+
+
+//============================================================================
+static bool menuActionEntryLess(const MenuActionEntry& a, const MenuActionEntry& b)
+{
+	return a.Key < b.Key;
+}
+
+/**
+ * Drop overlays shared by all dock managers if the SharedDropOverlays
+ * config flag is set
+ */
+struct SharedDropOverlays
+{
+	CDockOverlay* ContainerOverlay = nullptr;
+	CDockOverlay* DockAreaOverlay = nullptr;
+	int RefCount = 0;
+};
+static SharedDropOverlays SharedOverlays;
 
 /**
  * Private data class of CDockManager class (pimpl)
@@ -82,15 +136,27 @@ struct DockManagerPrivate
 	CDockManager* _this;
 	QList<CFloatingDockContainer*> FloatingWidgets;
 	QList<CDockContainerWidget*> Containers;
-	CDockOverlay* ContainerOverlay;
-	CDockOverlay* DockAreaOverlay;
+	CDockOverlay* ContainerOverlay = nullptr;
+	CDockOverlay* DockAreaOverlay = nullptr;
+	bool UsesSharedOverlays = false;
 	QMap<QString, CDockWidget*> DockWidgetsMap;
 	QMap<QString, QByteArray> Perspectives;
 	QMap<QString, QMenu*> ViewMenuGroups;
+	QHash<QMenu*, MenuActionIndex> MenuActionIndexes;
 	QMenu* ViewMenu;
 	CDockManager::eViewMenuInsertionOrder MenuInsertionOrder = CDockManager::MenuAlphabeticallySorted;
 	bool RestoringState = false;
+	internal::CResizeBurst RestoreResizeBurst;
 	QVector<CFloatingDockContainer*> UninitializedFloatingWidgets;
+	CDockWidgetSearchIndex SearchIndex;
+	CDockQuickSwitcher* QuickSwitcher = nullptr;
+	CDockFrameTimeObserver* FrameTimeObserver = nullptr;
+	QList<CDockWidget*> DockWidgetPool;
+	QSet<CDockWidget*> UnresetPoolDockWidgets;
+	int DockWidgetPoolSize = 0;
+	int LayoutChangeDepth = 0;
+	CDockManagerStatistics Statistics;
+	bool StatisticsEnabled = false;
 
 	/**
 	 * Private data constructor
@@ -145,9 +211,66 @@ struct DockManagerPrivate
 	void loadStylesheet();
 
 	/**
-	 * Adds action to menu - optionally in sorted order
+	 * Creates the drop overlays or attaches this dock manager to the
+	 * shared drop overlays. Does nothing if the overlays already exist
+	 */
+	void createOverlays();
+
+	/**
+	 * Deletes the overlays if they are owned by this dock manager or
+	 * detaches this dock manager from the shared overlays
+	 */
+	void releaseOverlays();
+
+	/**
+	 * Adds action to menu - optionally in sorted order.
+	 * Sorted insertion uses a binary search in the sorted action index of
+	 * the menu
 	 */
 	void addActionToMenu(QAction* Action, QMenu* Menu, bool InsertSorted);
+
+	/**
+	 * Queues the given actions for insertion into the given menu. The
+	 * actions are inserted when the menu is shown the next time or
+	 * if another action is added to the menu
+	 */
+	void addPendingActionsToMenu(const QList<QAction*>& Actions, QMenu* Menu);
+
+	/**
+	 * Inserts all pending actions of the given menu into the menu
+	 */
+	void flushPendingMenuActions(QMenu* Menu);
+
+	/**
+	 * Removes the given action from the sorted and pending actions of all
+	 * menu indexes
+	 */
+	void removeActionFromMenuIndexes(QAction* Action);
+
+	/**
+	 * Resets the given pooled dock widget if this has not been done yet
+	 */
+	void resetPooledDockWidget(CDockWidget* DockWidget);
+
+	/**
+	 * Returns the group menu for the given group and creates it, if it
+	 * does not exist yet
+	 */
+	QMenu* groupMenu(const QString& Group, const QIcon& GroupIcon);
+
+	/**
+	 * Makes the dock widget that owns the given toggle view action
+	 * searchable by the given group name
+	 */
+	void setSearchIndexGroup(QAction* ToggleViewAction, const QString& Group);
+
+	/**
+	 * Returns the open dock widget next to the closed current dock widget
+	 * of the given dock area. Dock widgets behind the current dock widget
+	 * are preferred. Returns a nullptr, if the dock area does not contain
+	 * any open dock widget.
+	 */
+	CDockWidget* nearestOpenDockWidget(CDockAreaWidget* DockArea) const;
 };
 // struct DockManagerPrivate
 
@@ -159,6 +282,57 @@ DockManagerPrivate::DockManagerPrivate(CDockManager* _public) :
 }
 
 
+//============================================================================
+void DockManagerPrivate::createOverlays()
+{
+	if (ContainerOverlay)
+	{
+		return;
+	}
+
+	if (!CDockManager::testConfigFlag(CDockManager::SharedDropOverlays))
+	{
+		DockAreaOverlay = new CDockOverlay(_this, CDockOverlay::ModeDockAreaOverlay);
+		ContainerOverlay = new CDockOverlay(_this, CDockOverlay::ModeContainerOverlay);
+		return;
+	}
+
+	if (!SharedOverlays.RefCount)
+	{
+		SharedOverlays.DockAreaOverlay = new CDockOverlay(nullptr, CDockOverlay::ModeDockAreaOverlay);
+		SharedOverlays.ContainerOverlay = new CDockOverlay(nullptr, CDockOverlay::ModeContainerOverlay);
+	}
+	SharedOverlays.RefCount++;
+	UsesSharedOverlays = true;
+	DockAreaOverlay = SharedOverlays.DockAreaOverlay;
+	ContainerOverlay = SharedOverlays.ContainerOverlay;
+}
+
+
+//============================================================================
+void DockManagerPrivate::releaseOverlays()
+{
+	if (!UsesSharedOverlays)
+	{
+		// Overlays owned by this dock manager are deleted with their parent
+		return;
+	}
+
+	UsesSharedOverlays = false;
+	DockAreaOverlay = nullptr;
+	ContainerOverlay = nullptr;
+	if (--SharedOverlays.RefCount)
+	{
+		return;
+	}
+
+	delete SharedOverlays.DockAreaOverlay;
+	delete SharedOverlays.ContainerOverlay;
+	SharedOverlays.DockAreaOverlay = nullptr;
+	SharedOverlays.ContainerOverlay = nullptr;
+}
+
+
 //============================================================================
 void DockManagerPrivate::loadStylesheet()
 {
@@ -212,6 +386,7 @@ bool DockManagerPrivate::restoreContainer(int Index, CDockingStateReader& stream
 //============================================================================
 bool DockManagerPrivate::checkFormat(const QByteArray &state, int version)
 {
+	ADS_TRACE_SCOPE("DockManager::checkFormat");
     return restoreStateFromXml(state, version, internal::RestoreTesting);
 }
 
@@ -220,6 +395,7 @@ bool DockManagerPrivate::checkFormat(const QByteArray &state, int version)
 bool DockManagerPrivate::restoreStateFromXml(const QByteArray &state,  int version,
 	bool Testing)
 {
+	ADS_TRACE_SCOPE("DockManager::restoreStateFromXml");
 	Q_UNUSED(version);
 
     if (state.isEmpty())
@@ -279,6 +455,7 @@ bool DockManagerPrivate::restoreStateFromXml(const QByteArray &state,  int versi
 //============================================================================
 void DockManagerPrivate::restoreDockWidgetsOpenState()
 {
+	ADS_TRACE_SCOPE("DockManager::restoreDockWidgetsOpenState");
     // All dock widgets, that have not been processed in the restore state
     // function are invisible to the user now and have no assigned dock area
     // They do not belong to any dock container, until the user toggles the
@@ -301,6 +478,7 @@ void DockManagerPrivate::restoreDockWidgetsOpenState()
 //============================================================================
 void DockManagerPrivate::restoreDockAreasIndices()
 {
+	ADS_TRACE_SCOPE("DockManager::restoreDockAreasIndices");
     // Now all dock areas are properly restored and we setup the index of
     // The dock areas because the previous toggleView() action has changed
     // the dock area index
@@ -340,6 +518,7 @@ void DockManagerPrivate::restoreDockAreasIndices()
 //============================================================================
 void DockManagerPrivate::emitTopLevelEvents()
 {
+	ADS_TRACE_SCOPE("DockManager::emitTopLevelEvents");
     // Finally we need to send the topLevelChanged() signals for all dock
     // widgets if top level changed
     for (auto DockContainer : Containers)
@@ -367,6 +546,7 @@ void DockManagerPrivate::emitTopLevelEvents()
 //============================================================================
 bool DockManagerPrivate::restoreState(const QByteArray& State, int version)
 {
+	ADS_TRACE_SCOPE("DockManager::restoreState");
 	QByteArray state = State.startsWith("<?xml") ? State : qUncompress(State);
     if (!checkFormat(state, version))
     {
@@ -395,27 +575,229 @@ bool DockManagerPrivate::restoreState(const QByteArray& State, int version)
 //============================================================================
 void DockManagerPrivate::addActionToMenu(QAction* Action, QMenu* Menu, bool InsertSorted)
 {
-	if (InsertSorted)
+	flushPendingMenuActions(Menu);
+	if (!InsertSorted)
+	{
+		Menu->addAction(Action);
+		return;
+	}
+
+	auto& Sorted = MenuActionIndexes[Menu].Sorted;
+	MenuActionEntry Entry{Action->text().toCaseFolded(), Action};
+	auto it = std::upper_bound(Sorted.begin(), Sorted.end(), Entry, menuActionEntryLess);
+	// Actions that have been deleted in the meantime are removed from
+	// the index if we hit them
+	while (it != Sorted.end() && !it->Action)
 	{
-		auto Actions = Menu->actions();
-		auto it = std::find_if(Actions.begin(), Actions.end(),
-			[&Action](const QAction* a)
+		it = Sorted.erase(it);
+	}
+
+	QAction* Before = (it == Sorted.end()) ? nullptr : it->Action.data();
+	Sorted.insert(it, Entry);
+	if (Before)
+	{
+		Menu->insertAction(Before, Action);
+	}
+	else
+	{
+		Menu->addAction(Action);
+	}
+}
+
+
+//============================================================================
+void DockManagerPrivate::addPendingActionsToMenu(const QList<QAction*>& Actions,
+	QMenu* Menu)
+{
+	auto& Index = MenuActionIndexes[Menu];
+	for (auto Action : Actions)
+	{
+		Index.Pending.append(Action);
+	}
+
+	if (!Index.FlushOnShow)
+	{
+		Index.FlushOnShow = true;
+		QObject::connect(Menu, &QMenu::aboutToShow, Menu, [this, Menu]()
+		{
+			flushPendingMenuActions(Menu);
+		});
+	}
+}
+
+
+//============================================================================
+void DockManagerPrivate::flushPendingMenuActions(QMenu* Menu)
+{
+	auto IndexIt = MenuActionIndexes.find(Menu);
+	if (IndexIt == MenuActionIndexes.end() || IndexIt->Pending.isEmpty())
+	{
+		return;
+	}
+
+	auto Pending = IndexIt->Pending;
+	IndexIt->Pending.clear();
+	if (CDockManager::MenuAlphabeticallySorted != MenuInsertionOrder)
+	{
+		for (const auto& Action : Pending)
+		{
+			if (Action)
 			{
-				return a->text().compare(Action->text(), Qt::CaseInsensitive) > 0;
-			});
+				Menu->addAction(Action);
+			}
+		}
+		return;
+	}
 
-		if (it == Actions.end())
+	// Sort the new actions once and merge them with the already inserted
+	// actions
+	QVector<MenuActionEntry> NewEntries;
+	NewEntries.reserve(Pending.count());
+	for (const auto& Action : Pending)
+	{
+		if (Action)
 		{
-			Menu->addAction(Action);
+			NewEntries.append({Action->text().toCaseFolded(), Action});
 		}
-		else
+	}
+	std::stable_sort(NewEntries.begin(), NewEntries.end(), menuActionEntryLess);
+
+	auto& Sorted = IndexIt->Sorted;
+	Sorted.erase(std::remove_if(Sorted.begin(), Sorted.end(),
+		[](const MenuActionEntry& Entry) {return Entry.Action.isNull();}), Sorted.end());
+	if (Sorted.isEmpty())
+	{
+		QList<QAction*> Actions;
+		Actions.reserve(NewEntries.count());
+		for (const auto& Entry : NewEntries)
 		{
-			Menu->insertAction(*it, Action);
+			Actions.append(Entry.Action);
 		}
+		Menu->addActions(Actions);
+		Sorted = NewEntries;
+		return;
 	}
-	else
+
+	QVector<MenuActionEntry> Merged;
+	Merged.reserve(Sorted.count() + NewEntries.count());
+	std::merge(Sorted.begin(), Sorted.end(), NewEntries.begin(), NewEntries.end(),
+		std::back_inserter(Merged), menuActionEntryLess);
+
+	// We walk backwards through the merged list, so each new action is
+	// inserted before its successor that is already in the menu
+	QVector<bool> IsNew(Merged.count(), false);
+	int NewIndex = NewEntries.count() - 1;
+	for (int i = Merged.count() - 1; i >= 0 && NewIndex >= 0; --i)
 	{
-		Menu->addAction(Action);
+		if (Merged[i].Action == NewEntries[NewIndex].Action)
+		{
+			IsNew[i] = true;
+			--NewIndex;
+		}
+	}
+
+	QAction* Before = nullptr;
+	for (int i = Merged.count() - 1; i >= 0; --i)
+	{
+		QAction* Action = Merged[i].Action;
+		if (IsNew[i])
+		{
+			if (Before)
+			{
+				Menu->insertAction(Before, Action);
+			}
+			else
+			{
+				Menu->addAction(Action);
+			}
+		}
+		Before = Action;
+	}
+	Sorted = Merged;
+}
+
+
+//============================================================================
+void DockManagerPrivate::removeActionFromMenuIndexes(QAction* Action)
+{
+	for (auto& Index : MenuActionIndexes)
+	{
+		Index.Sorted.erase(std::remove_if(Index.Sorted.begin(), Index.Sorted.end(),
+			[Action](const MenuActionEntry& Entry) {return Entry.Action == Action;}),
+			Index.Sorted.end());
+		Index.Pending.removeAll(Action);
+	}
+}
+
+
+//============================================================================
+void DockManagerPrivate::resetPooledDockWidget(CDockWidget* DockWidget)
+{
+	if (UnresetPoolDockWidgets.remove(DockWidget))
+	{
+		DockWidget->prepareForReuse();
+	}
+}
+
+
+//============================================================================
+QMenu* DockManagerPrivate::groupMenu(const QString& Group, const QIcon& GroupIcon)
+{
+	QMenu* GroupMenu = ViewMenuGroups.value(Group, 0);
+	if (!GroupMenu)
+	{
+		GroupMenu = new QMenu(Group, _this);
+		GroupMenu->setIcon(GroupIcon);
+		addActionToMenu(GroupMenu->menuAction(), ViewMenu,
+			CDockManager::MenuAlphabeticallySorted == MenuInsertionOrder);
+		ViewMenuGroups.insert(Group, GroupMenu);
+	}
+	else if (GroupMenu->icon().isNull() && !GroupIcon.isNull())
+	{
+		GroupMenu->setIcon(GroupIcon);
+	}
+
+	return GroupMenu;
+}
+
+
+//============================================================================
+CDockWidget* DockManagerPrivate::nearestOpenDockWidget(CDockAreaWidget* DockArea) const
+{
+	int CurrentIndex = DockArea->currentIndex();
+	int Count = DockArea->dockWidgetsCount();
+	for (int i = CurrentIndex + 1; i < Count; ++i)
+	{
+		auto DockWidget = DockArea->dockWidget(i);
+		if (!DockWidget->isClosed())
+		{
+			return DockWidget;
+		}
+	}
+
+	for (int i = CurrentIndex - 1; i >= 0; --i)
+	{
+		auto DockWidget = DockArea->dockWidget(i);
+		if (!DockWidget->isClosed())
+		{
+			return DockWidget;
+		}
+	}
+
+	return nullptr;
+}
+
+
+//============================================================================
+void DockManagerPrivate::setSearchIndexGroup(QAction* ToggleViewAction,
+	const QString& Group)
+{
+	// Toggle view actions are owned by their dock widget - this allows
+	// us to make the dock widget searchable by its group name
+	auto DockWidget = qobject_cast<CDockWidget*>(ToggleViewAction->parent());
+	if (DockWidget)
+	{
+		SearchIndex.setGroup(DockWidget, Group);
 	}
 }
 
@@ -433,8 +815,6 @@ CDockManager::CDockManager(QWidget *parent) :
 	}
 
 	d->ViewMenu = new QMenu(tr("Show View"), this);
-	d->DockAreaOverlay = new CDockOverlay(this, CDockOverlay::ModeDockAreaOverlay);
-	d->ContainerOverlay = new CDockOverlay(this, CDockOverlay::ModeContainerOverlay);
 	d->Containers.append(this);
 	d->loadStylesheet();
 }
@@ -447,6 +827,7 @@ CDockManager::~CDockManager()
 	{
 		delete FloatingWidget;
 	}
+	d->releaseOverlays();
 	delete d;
 }
 
@@ -487,6 +868,7 @@ void CDockManager::removeDockContainer(CDockContainerWidget* DockContainer)
 //============================================================================
 CDockOverlay* CDockManager::containerOverlay() const
 {
+	d->createOverlays();
 	return d->ContainerOverlay;
 }
 
@@ -494,6 +876,7 @@ CDockOverlay* CDockManager::containerOverlay() const
 //============================================================================
 CDockOverlay* CDockManager::dockAreaOverlay() const
 {
+	d->createOverlays();
 	return d->DockAreaOverlay;
 }
 
@@ -522,6 +905,8 @@ unsigned int CDockManager::zOrderIndex() const
 //============================================================================
 QByteArray CDockManager::saveState(int version) const
 {
+	internal::CScopedTiming Timing(d->StatisticsEnabled
+		? &d->Statistics.SaveState : nullptr);
     QByteArray xmldata;
     QXmlStreamWriter s(&xmldata);
     auto ConfigFlags = CDockManager::configFlags();
@@ -566,15 +951,30 @@ bool CDockManager::restoreState(const QByteArray &state, int version)
 	{
 		hide();
 	}
+	// Restoring the state resizes all dock widgets several times. The dock
+	// widgets that exist before the restore get one single resize burst
+	d->RestoreResizeBurst.end();
+	d->RestoreResizeBurst.begin(d->DockWidgetsMap.values());
 	d->RestoringState = true;
 	emit restoringState();
-	bool Result = d->restoreState(state, version);
+	bool Result;
+	{
+		internal::CScopedTiming Timing(d->StatisticsEnabled
+			? &d->Statistics.RestoreState : nullptr);
+		Result = d->restoreState(state, version);
+	}
 	d->RestoringState = false;
 	emit stateRestored();
 	if (!IsHidden)
 	{
 		show();
 	}
+	// The final relayout happens when the posted layout requests are
+	// processed. The burst ends after them in the next event loop iteration
+	QTimer::singleShot(0, this, [this]()
+	{
+		d->RestoreResizeBurst.end();
+	});
 
 	return Result;
 }
@@ -584,6 +984,7 @@ bool CDockManager::restoreState(const QByteArray &state, int version)
 CFloatingDockContainer* CDockManager::addDockWidgetFloating(CDockWidget* Dockwidget)
 {
 	d->DockWidgetsMap.insert(Dockwidget->objectName(), Dockwidget);
+	d->SearchIndex.insert(Dockwidget);
 	CDockAreaWidget* OldDockArea = Dockwidget->dockAreaWidget();
 	if (OldDockArea)
 	{
@@ -605,6 +1006,192 @@ CFloatingDockContainer* CDockManager::addDockWidgetFloating(CDockWidget* Dockwid
 }
 
 
+//============================================================================
+QList<CDockAreaWidget*> CDockManager::addDockWidgets(
+	const QList<CDockWidgetPlacement>& Placements)
+{
+	QList<CDockAreaWidget*> DockAreas;
+	QList<CDockWidget*> DockWidgets;
+	// The tabs of each dock area are collected and appended in one pass
+	// per dock area
+	QList<CDockAreaWidget*> TabDockAreas;
+	QHash<CDockAreaWidget*, QList<CDockWidget*>> TabDockWidgets;
+	DockAreas.reserve(Placements.count());
+	DockWidgets.reserve(Placements.count());
+
+	auto appendTabs = [&TabDockWidgets](CDockAreaWidget* DockArea)
+	{
+		auto it = TabDockWidgets.find(DockArea);
+		if (it != TabDockWidgets.end())
+		{
+			auto Tabs = it.value();
+			TabDockWidgets.erase(it);
+			DockArea->appendDockWidgets(Tabs);
+		}
+	};
+
+	beginLayoutChange();
+	for (const auto& Placement : Placements)
+	{
+		auto DockWidget = Placement.DockWidget;
+		auto TargetDockArea = Placement.TargetDockArea;
+		if (!TargetDockArea && Placement.TargetPlacement >= 0
+		 && Placement.TargetPlacement < DockAreas.count())
+		{
+			TargetDockArea = DockAreas[Placement.TargetPlacement];
+		}
+
+		CDockAreaWidget* DockArea;
+		if (TargetDockArea && CenterDockWidgetArea == Placement.Area
+		 && !DockWidget->dockAreaWidget())
+		{
+			d->DockWidgetsMap.insert(DockWidget->objectName(), DockWidget);
+			d->SearchIndex.insert(DockWidget);
+			DockWidget->setDockManager(this);
+			if (!TabDockWidgets.contains(TargetDockArea))
+			{
+				TabDockAreas.append(TargetDockArea);
+			}
+			TabDockWidgets[TargetDockArea].append(DockWidget);
+			DockArea = TargetDockArea;
+		}
+		else
+		{
+			// Pending tabs keep their position in front of a dock widget
+			// that is added to the same dock area
+			if (TargetDockArea)
+			{
+				appendTabs(TargetDockArea);
+			}
+			DockArea = addDockWidget(Placement.Area, DockWidget, TargetDockArea);
+		}
+		DockAreas.append(DockArea);
+		DockWidgets.append(DockWidget);
+	}
+
+	for (auto DockArea : TabDockAreas)
+	{
+		appendTabs(DockArea);
+	}
+	endLayoutChange();
+
+	emit dockWidgetsAdded(DockWidgets);
+	return DockAreas;
+}
+
+
+//============================================================================
+void CDockManager::closeDockWidgets(const QList<CDockWidget*>& DockWidgets)
+{
+	QList<CDockWidget*> CloseDockWidgets;
+	QList<CDockWidget*> HideDockWidgets;
+	for (auto DockWidget : DockWidgets)
+	{
+		if (DockWidget->features().testFlag(CDockWidget::DockWidgetDeleteOnClose))
+		{
+			CloseDockWidgets.append(DockWidget);
+		}
+		else
+		{
+			HideDockWidgets.append(DockWidget);
+		}
+	}
+
+	closeDockWidgetsInternal(CloseDockWidgets, HideDockWidgets);
+}
+
+
+//============================================================================
+void CDockManager::closeDockWidgetsInternal(const QList<CDockWidget*>& CloseDockWidgets,
+	const QList<CDockWidget*>& HideDockWidgets)
+{
+	beginLayoutChange();
+	// Deleting dock widgets may remove and delete dock areas, so we do this
+	// before we collect the dock areas of the hidden dock widgets
+	for (auto DockWidget : CloseDockWidgets)
+	{
+		DockWidget->closeDockWidgetInternal();
+	}
+
+	QList<QPointer<CDockWidget>> HiddenDockWidgets;
+	QList<CDockAreaWidget*> DockAreas;
+	for (auto DockWidget : HideDockWidgets)
+	{
+		if (DockWidget->isClosed())
+		{
+			continue;
+		}
+
+		DockWidget->hideViewInternal();
+		HiddenDockWidgets.append(DockWidget);
+		auto DockArea = DockWidget->dockAreaWidget();
+		if (DockArea && !DockAreas.contains(DockArea))
+		{
+			DockAreas.append(DockArea);
+		}
+	}
+
+	// Now we select the next open dock widget or hide the dock area, once
+	// per dock area
+	QList<CDockSplitter*> Splitters;
+	QList<CDockContainerWidget*> DockContainers;
+	for (auto DockArea : DockAreas)
+	{
+		auto DockContainer = DockArea->dockContainer();
+		if (DockContainer && !DockContainers.contains(DockContainer))
+		{
+			DockContainers.append(DockContainer);
+		}
+
+		auto CurrentDockWidget = DockArea->currentDockWidget();
+		if (!CurrentDockWidget || !CurrentDockWidget->isClosed())
+		{
+			continue;
+		}
+
+		auto NextDockWidget = d->nearestOpenDockWidget(DockArea);
+		if (NextDockWidget)
+		{
+			DockArea->setCurrentDockWidget(NextDockWidget);
+		}
+		else
+		{
+			DockArea->toggleView(false);
+			Splitters.append(internal::findParent<CDockSplitter*>(DockArea));
+		}
+	}
+	internal::hideEmptyParentSplitters(Splitters);
+
+	for (auto DockContainer : DockContainers)
+	{
+		auto FloatingWidget = DockContainer->floatingWidget();
+		if (!FloatingWidget)
+		{
+			continue;
+		}
+
+		if (DockContainer->openedDockAreas().isEmpty())
+		{
+			FloatingWidget->hide();
+		}
+		else
+		{
+			FloatingWidget->updateWindowTitle();
+		}
+	}
+	endLayoutChange();
+
+	for (auto DockWidget : HiddenDockWidgets)
+	{
+		if (DockWidget)
+		{
+			emit DockWidget->closed();
+			emit DockWidget->viewToggled(false);
+		}
+	}
+}
+
+
 //============================================================================
 void CDockManager::showEvent(QShowEvent *event)
 {
@@ -627,6 +1214,7 @@ CDockAreaWidget* CDockManager::addDockWidget(DockWidgetArea area,
 	CDockWidget* Dockwidget, CDockAreaWidget* DockAreaWidget)
 {
 	d->DockWidgetsMap.insert(Dockwidget->objectName(), Dockwidget);
+	d->SearchIndex.insert(Dockwidget);
 	return CDockContainerWidget::addDockWidget(area, Dockwidget, DockAreaWidget);
 }
 
@@ -670,6 +1258,7 @@ void CDockManager::removeDockWidget(CDockWidget* Dockwidget)
 {
 	emit dockWidgetAboutToBeRemoved(Dockwidget);
 	d->DockWidgetsMap.remove(Dockwidget->objectName());
+	d->SearchIndex.remove(Dockwidget);
 	CDockContainerWidget::removeDockWidget(Dockwidget);
 	emit dockWidgetRemoved(Dockwidget);
 }
@@ -730,7 +1319,11 @@ void CDockManager::openPerspective(const QString& PerspectiveName)
 	}
 
 	emit openingPerspective(PerspectiveName);
-	restoreState(Iterator.value());
+	{
+		internal::CScopedTiming Timing(d->StatisticsEnabled
+			? &d->Statistics.OpenPerspective : nullptr);
+		restoreState(Iterator.value());
+	}
 	emit perspectiveOpened(PerspectiveName);
 }
 
@@ -785,20 +1378,9 @@ QAction* CDockManager::addToggleViewActionToMenu(QAction* ToggleViewAction,
 	bool AlphabeticallySorted = (MenuAlphabeticallySorted == d->MenuInsertionOrder);
 	if (!Group.isEmpty())
 	{
-		QMenu* GroupMenu = d->ViewMenuGroups.value(Group, 0);
-		if (!GroupMenu)
-		{
-			GroupMenu = new QMenu(Group, this);
-			GroupMenu->setIcon(GroupIcon);
-			d->addActionToMenu(GroupMenu->menuAction(), d->ViewMenu, AlphabeticallySorted);
-			d->ViewMenuGroups.insert(Group, GroupMenu);
-		}
-		else if (GroupMenu->icon().isNull() && !GroupIcon.isNull())
-		{
-			GroupMenu->setIcon(GroupIcon);
-		}
-
+		QMenu* GroupMenu = d->groupMenu(Group, GroupIcon);
 		d->addActionToMenu(ToggleViewAction, GroupMenu, AlphabeticallySorted);
+		d->setSearchIndexGroup(ToggleViewAction, Group);
 		return GroupMenu->menuAction();
 	}
 	else
@@ -809,6 +1391,28 @@ QAction* CDockManager::addToggleViewActionToMenu(QAction* ToggleViewAction,
 }
 
 
+//============================================================================
+QAction* CDockManager::addToggleViewActionsToMenu(const QList<QAction*>& ToggleViewActions,
+	const QString& Group, const QIcon& GroupIcon)
+{
+	if (!Group.isEmpty())
+	{
+		QMenu* GroupMenu = d->groupMenu(Group, GroupIcon);
+		d->addPendingActionsToMenu(ToggleViewActions, GroupMenu);
+		for (auto Action : ToggleViewActions)
+		{
+			d->setSearchIndexGroup(Action, Group);
+		}
+		return GroupMenu->menuAction();
+	}
+	else
+	{
+		d->addPendingActionsToMenu(ToggleViewActions, d->ViewMenu);
+		return nullptr;
+	}
+}
+
+
 //============================================================================
 QMenu* CDockManager::viewMenu() const
 {
@@ -830,6 +1434,52 @@ bool CDockManager::isRestoringState() const
 }
 
 
+//===========================================================================
+void CDockManager::beginLayoutChange()
+{
+	// Disabling updates prevents repaints of the intermediate layouts
+	if (!d->LayoutChangeDepth++)
+	{
+		setUpdatesEnabled(false);
+	}
+}
+
+
+//===========================================================================
+void CDockManager::endLayoutChange()
+{
+	if (d->LayoutChangeDepth <= 0 || --d->LayoutChangeDepth > 0)
+	{
+		return;
+	}
+
+	// The signals emitted by the containers may add or delete containers
+	// so we iterate over guarded copies here
+	QList<QPointer<CDockContainerWidget>> Containers;
+	for (auto DockContainer : d->Containers)
+	{
+		Containers.append(DockContainer);
+	}
+
+	for (auto DockContainer : Containers)
+	{
+		if (DockContainer)
+		{
+			DockContainer->commitLayoutChange();
+		}
+	}
+	d->emitTopLevelEvents();
+	setUpdatesEnabled(true);
+}
+
+
+//===========================================================================
+bool CDockManager::isLayoutChangeActive() const
+{
+	return d->LayoutChangeDepth > 0;
+}
+
+
 //===========================================================================
 int CDockManager::startDragDistance()
 {
@@ -837,6 +1487,247 @@ int CDockManager::startDragDistance()
 }
 
 
+//============================================================================
+bool CDockManager::recycleDockWidget(CDockWidget* DockWidget)
+{
+	if (d->DockWidgetPool.count() >= d->DockWidgetPoolSize)
+	{
+		return false;
+	}
+
+	// The dock widget is reset after the closed() signal has reached the
+	// receivers of its current user - or when it is handed out again by
+	// createDockWidget(), whatever happens first
+	DockWidget->prepareForPool();
+	d->DockWidgetPool.append(DockWidget);
+	d->UnresetPoolDockWidgets.insert(DockWidget);
+	QPointer<CDockWidget> PooledDockWidget(DockWidget);
+	QTimer::singleShot(0, this, [this, PooledDockWidget]()
+	{
+		if (PooledDockWidget)
+		{
+			d->resetPooledDockWidget(PooledDockWidget);
+		}
+	});
+	return true;
+}
+
+
+//============================================================================
+void CDockManager::removeToggleViewActionFromMenus(QAction* ToggleViewAction)
+{
+	d->removeActionFromMenuIndexes(ToggleViewAction);
+	for (auto Widget : ToggleViewAction->associatedWidgets())
+	{
+		Widget->removeAction(ToggleViewAction);
+	}
+}
+
+
+//============================================================================
+void CDockManager::setDockWidgetPoolSize(int Size)
+{
+	d->DockWidgetPoolSize = qMax(0, Size);
+	while (d->DockWidgetPool.count() > d->DockWidgetPoolSize)
+	{
+		auto DockWidget = d->DockWidgetPool.takeLast();
+		d->UnresetPoolDockWidgets.remove(DockWidget);
+		DockWidget->deleteLater();
+	}
+}
+
+
+//============================================================================
+int CDockManager::dockWidgetPoolSize() const
+{
+	return d->DockWidgetPoolSize;
+}
+
+
+//============================================================================
+CDockWidget* CDockManager::createDockWidget(const QString& Title)
+{
+	if (d->DockWidgetPool.isEmpty())
+	{
+		return new CDockWidget(Title);
+	}
+
+	CDockWidget* DockWidget = d->DockWidgetPool.takeLast();
+	d->resetPooledDockWidget(DockWidget);
+	DockWidget->setClosedState(false);
+	DockWidget->setWindowTitle(Title);
+	DockWidget->setObjectName(Title);
+	return DockWidget;
+}
+
+
+//============================================================================
+void CDockManager::updateSearchIndex(CDockWidget* DockWidget)
+{
+	d->SearchIndex.update(DockWidget);
+}
+
+
+//============================================================================
+QList<CDockWidget*> CDockManager::searchDockWidgets(const QString& Text, int MaxCount) const
+{
+	return d->SearchIndex.query(Text, MaxCount);
+}
+
+
+//============================================================================
+CDockQuickSwitcher* CDockManager::quickSwitcher() const
+{
+	if (!d->QuickSwitcher)
+	{
+		d->QuickSwitcher = new CDockQuickSwitcher(const_cast<CDockManager*>(this));
+	}
+	return d->QuickSwitcher;
+}
+
+
+//============================================================================
+CDockFrameTimeObserver* CDockManager::frameTimeObserver() const
+{
+	if (!d->FrameTimeObserver)
+	{
+		d->FrameTimeObserver = new CDockFrameTimeObserver(const_cast<CDockManager*>(this));
+	}
+	return d->FrameTimeObserver;
+}
+
+
+//============================================================================
+CDockManagerStatistics* CDockManager::mutableStatistics() const
+{
+	return d->StatisticsEnabled ? &d->Statistics : nullptr;
+}
+
+
+//============================================================================
+CDockManagerStatistics CDockManager::statistics() const
+{
+	CDockManagerStatistics Result = d->Statistics;
+	Result.ContainerCount = d->Containers.count();
+	Result.FloatingContainerCount = d->FloatingWidgets.count();
+	Result.DockAreaCount = 0;
+	Result.SplitterCount = 0;
+	Result.MaxSplitterDepth = 0;
+	for (auto Container : d->Containers)
+	{
+		Result.DockAreaCount += Container->dockAreaCount();
+		Result.SplitterCount += Container->splitterCount();
+		Result.MaxSplitterDepth = qMax(Result.MaxSplitterDepth,
+			Container->splitterTreeDepth());
+	}
+
+	Result.DockWidgetCount = d->DockWidgetsMap.count();
+	Result.OpenDockWidgetCount = 0;
+	for (auto DockWidget : d->DockWidgetsMap)
+	{
+		if (!DockWidget->isClosed())
+		{
+			Result.OpenDockWidgetCount++;
+		}
+	}
+	return Result;
+}
+
+
+//============================================================================
+void CDockManager::resetStatistics()
+{
+	d->Statistics = CDockManagerStatistics();
+}
+
+
+//============================================================================
+void CDockManager::setStatisticsEnabled(bool Enabled)
+{
+	d->StatisticsEnabled = Enabled;
+}
+
+
+//============================================================================
+bool CDockManager::statisticsEnabled() const
+{
+	return d->StatisticsEnabled;
+}
+
+
+//============================================================================
+CDockManagerFootprint CDockManager::footprint() const
+{
+	CDockManagerFootprint Result;
+	Result.MainContainer = containerFootprint();
+	for (auto FloatingWidget : d->FloatingWidgets)
+	{
+		Result.FloatingContainers.append(
+			FloatingWidget->dockContainer()->containerFootprint());
+	}
+
+	for (auto DockWidget : d->DockWidgetsMap)
+	{
+		if (!DockWidget->dockContainer())
+		{
+			Result.UnassignedDockWidgetCount++;
+			Result.UnassignedDockWidgets += DockWidget->footprint();
+		}
+	}
+
+	for (auto DockWidget : d->DockWidgetPool)
+	{
+		Result.PooledDockWidgetCount++;
+		Result.PooledDockWidgets += DockWidget->footprint();
+	}
+
+	QList<CDockContainerFootprint> Containers = Result.FloatingContainers;
+	Containers.prepend(Result.MainContainer);
+	CDockWidgetFootprint DockWidgets = Result.UnassignedDockWidgets;
+	DockWidgets += Result.PooledDockWidgets;
+	for (const auto& Container : Containers)
+	{
+		Result.ObjectCount += Container.ObjectCount;
+		Result.WidgetCount += Container.WidgetCount;
+		Result.PrivateDataBytes += Container.PrivateDataBytes;
+		DockWidgets += Container.DockWidgets;
+	}
+
+	Result.ObjectCount += DockWidgets.ObjectCount;
+	Result.WidgetCount += DockWidgets.WidgetCount;
+	Result.PrivateDataBytes += DockWidgets.PrivateDataBytes + sizeof(DockManagerPrivate);
+	Result.ContentObjectCount = DockWidgets.ContentObjectCount;
+	Result.ContentWidgetCount = DockWidgets.ContentWidgetCount;
+	return Result;
+}
+
+
+//============================================================================
+CDockLayoutSnapshot CDockManager::snapshotLayout() const
+{
+	CDockLayoutSnapshot Snapshot;
+	for (auto Container : d->Containers)
+	{
+		Snapshot.Containers.append(Container->layoutSnapshot());
+	}
+	return Snapshot;
+}
+
+
+//============================================================================
+void CDockManager::showQuickSwitcher()
+{
+	auto Popup = quickSwitcher();
+	QWidget* Window = this->window();
+	int Width = qMax(300, Window->width() / 3);
+	Popup->resize(Width, qMax(Popup->sizeHint().height(), 300));
+	QPoint TopLeft = Window->mapToGlobal(QPoint((Window->width() - Width) / 2,
+		Window->height() / 8));
+	Popup->move(TopLeft);
+	Popup->show();
+}
+
+
 //===========================================================================
 CDockManager::ConfigFlags CDockManager::configFlags()
 {
@@ -864,6 +1755,20 @@ bool CDockManager::testConfigFlag(eConfigFlag Flag)
 }
 
 
+//===========================================================================
+void CDockManager::setLiveSplitterResizeInterval(int Milliseconds)
+{
+	StaticLiveSplitterResizeInterval = qMax(1, Milliseconds);
+}
+
+
+//===========================================================================
+int CDockManager::liveSplitterResizeInterval()
+{
+	return StaticLiveSplitterResizeInterval;
+}
+
+
 //===========================================================================
 CIconProvider& CDockManager::iconProvider()
 {
@@ -872,6 +1777,21 @@ CIconProvider& CDockManager::iconProvider()
 }
 
 
+//===========================================================================
+CDockLayoutChangeGuard::CDockLayoutChangeGuard(CDockManager* DockManager) :
+	DockManager(DockManager)
+{
+	DockManager->beginLayoutChange();
+}
+
+
+//===========================================================================
+CDockLayoutChangeGuard::~CDockLayoutChangeGuard()
+{
+	DockManager->endLayoutChange();
+}
+
+
 } // namespace ads
 
 //---------------------------------------------------------------------------
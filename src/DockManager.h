@@ -34,6 +34,8 @@
 #include "DockContainerWidget.h"
 #include "DockWidget.h"
 #include "FloatingDockContainer.h"
+#include "DockStatistics.h"
+#include "DockLayoutSnapshot.h"
 
 
 QT_FORWARD_DECLARE_CLASS(QSettings)
@@ -53,6 +55,69 @@ struct DockWidgetTabPrivate;
 struct DockAreaWidgetPrivate;
 class CIconProvider;
 class CDockComponentsFactory;
+class CDockQuickSwitcher;
+class CDockFrameTimeObserver;
+
+
+/**
+ * Describes where CDockManager::addDockWidgets() inserts a single dock
+ * widget. The dock widget is inserted into the given Area of the
+ * TargetDockArea or into the given Area of the container if there is no
+ * target dock area. Instead of an existing dock area, TargetPlacement may
+ * refer to the index of a previous placement in the same list. Its dock
+ * area is then used as target dock area. This way a complete layout tree can
+ * be described in one single list.
+ */
+struct CDockWidgetPlacement
+{
+	CDockWidget* DockWidget = nullptr;
+	DockWidgetArea Area = CenterDockWidgetArea;
+	CDockAreaWidget* TargetDockArea = nullptr;
+	int TargetPlacement = -1;
+
+	CDockWidgetPlacement() = default;
+
+	/**
+	 * Places the dock widget relative to an existing dock area or relative
+	 * to the container, if TargetDockArea is a nullptr
+	 */
+	CDockWidgetPlacement(CDockWidget* DockWidget, DockWidgetArea Area,
+		CDockAreaWidget* TargetDockArea = nullptr)
+		: DockWidget(DockWidget), Area(Area), TargetDockArea(TargetDockArea)
+	{}
+
+	/**
+	 * Places the dock widget relative to the dock area of the previous
+	 * placement with the index TargetPlacement
+	 */
+	CDockWidgetPlacement(CDockWidget* DockWidget, DockWidgetArea Area,
+		int TargetPlacement)
+		: DockWidget(DockWidget), Area(Area), TargetPlacement(TargetPlacement)
+	{}
+};
+
+
+/**
+ * Approximate memory footprint of the complete docking system of a dock
+ * manager. The totals contain all containers and all registered dock
+ * widgets. The objects of the application content widgets are reported
+ * separately in the content counts.
+ */
+struct CDockManagerFootprint
+{
+	CDockContainerFootprint MainContainer; ///< the dock manager container
+	QList<CDockContainerFootprint> FloatingContainers; ///< one entry per floating container
+	int UnassignedDockWidgetCount = 0; ///< registered dock widgets without container
+	CDockWidgetFootprint UnassignedDockWidgets; ///< sum of the footprints of the unassigned dock widgets
+	int PooledDockWidgetCount = 0; ///< dock widgets kept for reuse (see setDockWidgetPoolSize())
+	CDockWidgetFootprint PooledDockWidgets; ///< sum of the footprints of the pooled dock widgets
+	int ObjectCount = 0; ///< QObjects created by the docking system
+	int WidgetCount = 0; ///< QWidgets among the counted objects
+	int PrivateDataBytes = 0; ///< heap bytes of all private data
+	int ContentObjectCount = 0; ///< QObjects of all application content widgets
+	int ContentWidgetCount = 0; ///< QWidgets of all application content widgets
+};
+
 
 /**
  * The central dock manager that maintains the complete docking system.
@@ -83,6 +148,7 @@ private:
 	friend class CFloatingDragPreview;
 	friend struct FloatingDragPreviewPrivate;
 	friend class CDockAreaTitleBar;
+	friend class CDockWidget;
 
 protected:
 	/**
@@ -109,15 +175,58 @@ protected:
 	void removeDockContainer(CDockContainerWidget* DockContainer);
 
 	/**
-	 * Overlay for containers
+	 * Overlay for containers.
+	 * The overlays are created on first access - that means when the first
+	 * drag operation starts
 	 */
 	CDockOverlay* containerOverlay() const;
 
 	/**
-	 * Overlay for dock areas
+	 * Overlay for dock areas.
+	 * \see containerOverlay()
 	 */
 	CDockOverlay* dockAreaOverlay() const;
 
+	/**
+	 * Adds the given dock widget to the dock widget pool if the pool is
+	 * not full. Returns false, if the dock widget has not been recycled and
+	 * needs to be deleted.
+	 */
+	bool recycleDockWidget(CDockWidget* DockWidget);
+
+	/**
+	 * Removes the given toggle view action from all menus and widgets and
+	 * from the sorted menu indexes. Used for recycled dock widgets.
+	 */
+	void removeToggleViewActionFromMenus(QAction* ToggleViewAction);
+
+	/**
+	 * Closes many dock widgets in one batch.
+	 * The dock widgets in CloseDockWidgets are closed via
+	 * CDockWidget::closeDockWidgetInternal() and the dock widgets in
+	 * HideDockWidgets are marked as closed. Then the current dock widget and
+	 * the visibility of each affected dock area is recomputed once, empty
+	 * splitters are hidden in one single bottom up pass and finally the
+	 * closed() and viewToggled() signals are emitted for all hidden dock
+	 * widgets.
+	 */
+	void closeDockWidgetsInternal(const QList<CDockWidget*>& CloseDockWidgets,
+		const QList<CDockWidget*>& HideDockWidgets);
+
+	/**
+	 * Updates the search index entry of the given dock widget.
+	 * This function is called by the dock widget if its title changed
+	 */
+	void updateSearchIndex(CDockWidget* DockWidget);
+
+	/**
+	 * Returns the statistics that record timings and event counters or
+	 * a nullptr if statistics are disabled.
+	 * Use internal::CScopedTiming with the returned statistics to record
+	 * the duration of an operation.
+	 */
+	CDockManagerStatistics* mutableStatistics() const;
+
 	/**
 	 * Show the floating widgets that has been created floating
 	 */
@@ -161,6 +270,10 @@ public:
 		FloatingContainerHasWidgetIcon = 0x80000, //!< If set, the Floating Widget icon reflects the icon of the current dock widget otherwise it displays application icon
 		HideSingleCentralWidgetTitleBar = 0x100000, //!< If there is only one single visible dock widget in the main dock container (the dock manager) and if this flag is set, then the titlebar of this dock widget will be hidden
 		                                            //!< this only makes sense for non draggable and non floatable widgets and enables the creation of some kind of "central" widget
+		LiveSplitterResize = 0x200000, //!< If set, splitters resize their content while dragging like OpaqueSplitterResize, but at most once per liveSplitterResizeInterval() - this flag takes precedence over OpaqueSplitterResize
+		DeferredSplitterSizes = 0x400000, //!< If set, restoreState() does not apply the saved splitter sizes immediately. The proportional sizes from the saved state are applied in one single pass as soon as the container is shown with its real geometry
+		SharedDropOverlays = 0x800000, //!< If set, all dock managers of the process share one single pair of drop overlays. The shared overlays have no parent widget, so style sheet rules for the overlays need to be set on the application
+		LeanDockWidgets = 0x1000000, //!< If set, new dock widgets create their layout, tab and toggle view action on first use instead of in the constructor. This reduces the memory footprint of many registered dock widgets that are never shown
 
 
         DefaultDockAreaButtons = DockAreaHasCloseButton
@@ -221,6 +334,20 @@ public:
 	 */
 	static bool testConfigFlag(eConfigFlag Flag);
 
+	/**
+	 * Sets the minimum interval in milliseconds between two resize steps of
+	 * a splitter if the LiveSplitterResize flag is set. The default value
+	 * is 33 ms - that means, the content is resized with a maximum rate of
+	 * approximately 30 frames per second.
+	 * Call this function before you create the dock manager.
+	 */
+	static void setLiveSplitterResizeInterval(int Milliseconds);
+
+	/**
+	 * Returns the live splitter resize interval in milliseconds
+	 */
+	static int liveSplitterResizeInterval();
+
 	/**
 	 * Returns the global icon provider.
 	 * The icon provider enables the use of custom icons in case using
@@ -266,6 +393,36 @@ public:
 	 */
 	CFloatingDockContainer* addDockWidgetFloating(CDockWidget* Dockwidget);
 
+	/**
+	 * Adds all dock widgets of the given placement list in one single layout
+	 * change transaction and returns the dock area of each placement.
+	 * Dock widgets that are added as tabs are collected per dock area and
+	 * appended in one pass per dock area, so the tab bar, the minimum size
+	 * hint and the title bar buttons of each dock area are updated once.
+	 * The last open tab added to each dock area is made current. Placements
+	 * that open a new dock area still create the dock area and its splitter
+	 * one after the other. The dock manager emits one single dockWidgetsAdded() signal
+	 * after all dock widgets have been added.
+	 * \code
+	 * QList<ads::CDockWidgetPlacement> Placements;
+	 * Placements << ads::CDockWidgetPlacement(Editor, ads::CenterDockWidgetArea)
+	 *     << ads::CDockWidgetPlacement(Output, ads::BottomDockWidgetArea, 0)
+	 *     << ads::CDockWidgetPlacement(Console, ads::CenterDockWidgetArea, 1);
+	 * DockManager->addDockWidgets(Placements);
+	 * \endcode
+	 */
+	QList<CDockAreaWidget*> addDockWidgets(const QList<CDockWidgetPlacement>& Placements);
+
+	/**
+	 * Closes all given dock widgets in one batch.
+	 * This has the same effect as closing each dock widget via its tab
+	 * close button - dock widgets with the DockWidgetDeleteOnClose feature
+	 * are deleted - but the dock areas, the splitters and the title bars are
+	 * updated only once for all dock widgets and no intermediate layouts
+	 * are created.
+	 */
+	void closeDockWidgets(const QList<CDockWidget*>& DockWidgets);
+
 	/**
 	 * Searches for a registered doc widget with the given ObjectName
 	 * \return Return the found dock widget or nullptr if a dock widget with the
@@ -376,6 +533,20 @@ public:
 	QAction* addToggleViewActionToMenu(QAction* ToggleViewAction,
 		const QString& Group = QString(), const QIcon& GroupIcon = QIcon());
 
+	/**
+	 * Adds a list of toggle view actions to the internal view menu.
+	 * Use this function instead of addToggleViewActionToMenu() if you
+	 * register a large number of dock widgets at once. The actions are
+	 * sorted only once and are inserted into the menu the next time the
+	 * menu is about to be shown, so the menu does not contain the actions
+	 * before it has been shown the first time.
+	 * \return If Group is not empty, this function returns the GroupAction
+	 *         for this group. If the group is empty, the function returns
+	 *         a nullptr.
+	 */
+	QAction* addToggleViewActionsToMenu(const QList<QAction*>& ToggleViewActions,
+		const QString& Group = QString(), const QIcon& GroupIcon = QIcon());
+
 	/**
 	 * This function returns the internal view menu.
 	 * To fill the view menu, you can use the addToggleViewActionToMenu()
@@ -399,18 +570,149 @@ public:
 	 */
 	bool isRestoringState() const;
 
+	/**
+	 * Opens a layout change transaction.
+	 * While a transaction is open, the dock containers do not emit the
+	 * dockAreasAdded(), dockAreasRemoved() and dockAreaViewToggled() signals,
+	 * the dock widgets do not emit topLevelChanged() and the title bar
+	 * visibility and title bar button states are not updated. All this
+	 * derived state is recomputed once per container and the coalesced
+	 * signals are emitted when the outermost transaction is closed with
+	 * endLayoutChange(). Transactions can be nested.
+	 * Use this function if you add or remove many dock widgets
+	 * programmatically, i.e. if you setup the initial layout of your
+	 * application.
+	 * \see CDockLayoutChangeGuard
+	 */
+	void beginLayoutChange();
+
+	/**
+	 * Closes a layout change transaction opened with beginLayoutChange().
+	 * If this closes the outermost transaction, all deferred updates are
+	 * applied and the coalesced signals are emitted.
+	 */
+	void endLayoutChange();
+
+	/**
+	 * Returns true, if a layout change transaction is open
+	 */
+	bool isLayoutChangeActive() const;
+
 	/**
 	 * The distance the user needs to move the mouse with the left button
 	 * hold down before a dock widget start floating
 	 */
 	static int startDragDistance();
 
+	/**
+	 * Sets the maximum number of deleted dock widgets that are kept for
+	 * reuse. If the pool size is > 0, dock widgets with the
+	 * DockWidgetDeleteOnClose feature are not deleted if they are closed.
+	 * Their toggle view action is removed from all menus. After the closed()
+	 * signal has been emitted, their content widget is deleted and the dock
+	 * widget is reset and kept for reuse by createDockWidget(). The default
+	 * pool size is 0.
+	 * \note Recycled dock widgets do not emit the destroyed() signal and
+	 * signal connections with the recycled dock widget as receiver
+	 * are not removed. Only enable recycling if your application does not
+	 * rely on this.
+	 */
+	void setDockWidgetPoolSize(int Size);
+
+	/**
+	 * Returns the maximum number of recycled dock widgets
+	 */
+	int dockWidgetPoolSize() const;
+
+	/**
+	 * Returns a new dock widget with the given title.
+	 * If a recycled dock widget is available, it is reused. Otherwise the
+	 * function creates a new dock widget. Use this function instead of
+	 * new CDockWidget(Title) to benefit from dock widget recycling.
+	 */
+	CDockWidget* createDockWidget(const QString& Title);
+
+	/**
+	 * Returns the dock widgets that match the given search text best.
+	 * The text is matched fuzzy against the titles, object names and
+	 * view menu groups of all dock widgets registered in this dock manager.
+	 * The result is sorted by descending relevance. If MaxCount is negative,
+	 * all matching dock widgets are returned.
+	 */
+	QList<CDockWidget*> searchDockWidgets(const QString& Text, int MaxCount = -1) const;
+
+	/**
+	 * Returns the quick switcher popup of this dock manager.
+	 * The popup is created on first access.
+	 */
+	CDockQuickSwitcher* quickSwitcher() const;
+
+	/**
+	 * Returns the frame time observer of this dock manager.
+	 * The observer is created on first access and is disabled by default.
+	 * Enable it to measure the frame times of drag and splitter
+	 * interactions.
+	 */
+	CDockFrameTimeObserver* frameTimeObserver() const;
+
+	/**
+	 * Returns the current docking statistics.
+	 * The structure counts like the number of dock areas or the splitter
+	 * depth are calculated on each call. The timings and event counters
+	 * contain the values recorded since statistics have been enabled or
+	 * since the last resetStatistics() call.
+	 */
+	CDockManagerStatistics statistics() const;
+
+	/**
+	 * Resets all recorded timings and event counters
+	 */
+	void resetStatistics();
+
+	/**
+	 * Enables or disables the recording of timings and event counters.
+	 * Statistics are disabled by default, so that the docking system does
+	 * not pay for the measurements if nobody is interested in them.
+	 */
+	void setStatisticsEnabled(bool Enabled);
+
+	/**
+	 * Returns true, if timings and event counters are recorded
+	 */
+	bool statisticsEnabled() const;
+
+	/**
+	 * Walks all containers and registered dock widgets and returns the
+	 * approximate memory footprint of the docking system with a summary
+	 * for the main container and for each floating container.
+	 * The walk visits every object of the docking system, so do not call
+	 * this function in performance critical code.
+	 */
+	CDockManagerFootprint footprint() const;
+
+	/**
+	 * Returns a snapshot of the complete layout of all containers as plain
+	 * value types - the splitter trees with orientation and sizes, the dock
+	 * areas with tab order, open state and current index and the screen
+	 * geometries. Use this function to inspect a layout from tests or
+	 * external tools without parsing the saveState() XML.
+	 */
+	CDockLayoutSnapshot snapshotLayout() const;
+
 public slots:
 	/**
 	 * Opens the perspective with the given name.
 	 */
 	void openPerspective(const QString& PerspectiveName);
 
+	/**
+	 * Shows the quick switcher popup centered in the window of the dock
+	 * manager. You can connect this slot to an application shortcut
+	 * (i.e. Ctrl+K) to let the user jump to any dock widget by typing
+	 * a part of its title.
+	 */
+	void showQuickSwitcher();
+
 signals:
 	/**
 	 * This signal is emitted if the list of perspectives changed
@@ -479,7 +781,44 @@ signals:
      * docking system but it is not deleted yet.
      */
     void dockWidgetRemoved(CDockWidget* DockWidget);
+
+    /**
+     * This signal is emitted once by addDockWidgets() after all dock widgets
+     * of the placement list have been added.
+     */
+    void dockWidgetsAdded(const QList<CDockWidget*>& DockWidgets);
 }; // class DockManager
+
+
+/**
+ * Opens a layout change transaction of the given dock manager in the
+ * constructor and closes it in the destructor.
+ * \code
+ * {
+ *     ads::CDockLayoutChangeGuard LayoutChangeGuard(DockManager);
+ *     DockManager->addDockWidget(ads::LeftDockWidgetArea, DockWidget1);
+ *     DockManager->addDockWidget(ads::RightDockWidgetArea, DockWidget2);
+ * }
+ * \endcode
+ * \see CDockManager::beginLayoutChange()
+ */
+class ADS_EXPORT CDockLayoutChangeGuard
+{
+private:
+	CDockManager* DockManager;
+	Q_DISABLE_COPY(CDockLayoutChangeGuard)
+
+public:
+	/**
+	 * Opens a layout change transaction
+	 */
+	CDockLayoutChangeGuard(CDockManager* DockManager);
+
+	/**
+	 * Closes the layout change transaction
+	 */
+	~CDockLayoutChangeGuard();
+}; // class DockLayoutChangeGuard
 } // namespace ads
 //-----------------------------------------------------------------------------
 #endif // DockManagerH
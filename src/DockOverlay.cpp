@@ -38,6 +38,7 @@
 
 #include "DockAreaWidget.h"
 #include "DockAreaTitleBar.h"
+#include "DockTrace.h"
 
 #include <iostream>
 
@@ -351,6 +352,12 @@ CDockOverlay::CDockOverlay(QWidget* parent, eMode Mode) :
 //============================================================================
 CDockOverlay::~CDockOverlay()
 {
+	// The cross has the same parent like this overlay. A shared overlay has
+	// no parent, so nobody else would delete its cross
+	if (!d->Cross->parent())
+	{
+		delete d->Cross;
+	}
 	delete d;
 }
 
@@ -469,6 +476,7 @@ bool CDockOverlay::dropPreviewEnabled() const
 //============================================================================
 void CDockOverlay::paintEvent(QPaintEvent* event)
 {
+	ADS_TRACE_SCOPE("DockOverlay::paintEvent");
 	Q_UNUSED(event);
 	// Draw rect based on location
 	if (!d->DropPreviewEnabled)
@@ -0,0 +1,261 @@
+/*******************************************************************************
+** Qt Advanced Docking System
+** Copyright (C) 2017 Uwe Kindler
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 2.1 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+
+//============================================================================
+/// \file   DockQuickSwitcher.cpp
+/// \author Uwe Kindler
+/// \date   19.10.2026
+/// \brief  Implementation of CDockQuickSwitcher class
+//============================================================================
+
+
+//============================================================================
+//                                   INCLUDES
+//============================================================================
+#include "DockQuickSwitcher.h"
+
+#include <QBoxLayout>
+#include <QKeyEvent>
+#include <QLineEdit>
+#include <QListWidget>
+#include <QPointer>
+
+#include "DockManager.h"
+#include "DockWidget.h"
+
+
+namespace ads
+{
+/**
+ * Private data class of CDockQuickSwitcher class (pimpl)
+ */
+struct DockQuickSwitcherPrivate
+{
+	CDockQuickSwitcher* _this;
+	CDockManager* DockManager;
+	QLineEdit* SearchEdit;
+	QListWidget* ResultList;
+	QList<QPointer<CDockWidget>> Results;
+	int MaxResultCount = 20;
+
+	/**
+	 * Private data constructor
+	 */
+	DockQuickSwitcherPrivate(CDockQuickSwitcher* _public);
+
+	/**
+	 * Creates the search edit and the result list
+	 */
+	void createContent();
+
+	/**
+	 * Fills the result list with the results for the given search text
+	 */
+	void updateResults(const QString& Text);
+
+	/**
+	 * Moves the current row of the result list by the given offset
+	 */
+	void moveCurrentRow(int Offset);
+};
+// struct DockQuickSwitcherPrivate
+
+
+//============================================================================
+DockQuickSwitcherPrivate::DockQuickSwitcherPrivate(CDockQuickSwitcher* _public) :
+	_this(_public)
+{
+
+}
+
+
+//============================================================================
+void DockQuickSwitcherPrivate::createContent()
+{
+	QBoxLayout* Layout = new QBoxLayout(QBoxLayout::TopToBottom);
+	Layout->setContentsMargins(4, 4, 4, 4);
+	Layout->setSpacing(2);
+	_this->setLayout(Layout);
+
+	SearchEdit = new QLineEdit(_this);
+	SearchEdit->setObjectName("quickSwitcherSearchEdit");
+	SearchEdit->setPlaceholderText(QObject::tr("Search dock widgets..."));
+	SearchEdit->setClearButtonEnabled(true);
+	SearchEdit->installEventFilter(_this);
+	Layout->addWidget(SearchEdit);
+
+	ResultList = new QListWidget(_this);
+	ResultList->setObjectName("quickSwitcherResultList");
+	ResultList->setFocusPolicy(Qt::NoFocus);
+	ResultList->setUniformItemSizes(true);
+	Layout->addWidget(ResultList);
+
+	_this->connect(SearchEdit, SIGNAL(textChanged(const QString&)),
+		SLOT(onTextChanged(const QString&)));
+	_this->connect(SearchEdit, SIGNAL(returnPressed()), SLOT(onItemActivated()));
+	_this->connect(ResultList, SIGNAL(itemClicked(QListWidgetItem*)),
+		SLOT(onItemActivated()));
+}
+
+
+//============================================================================
+void DockQuickSwitcherPrivate::updateResults(const QString& Text)
+{
+	Results.clear();
+	ResultList->clear();
+	for (auto DockWidget : DockManager->searchDockWidgets(Text, MaxResultCount))
+	{
+		Results.append(DockWidget);
+		auto Item = new QListWidgetItem(DockWidget->icon(), DockWidget->windowTitle());
+		if (DockWidget->isClosed())
+		{
+			Item->setForeground(_this->palette().color(QPalette::Disabled, QPalette::Text));
+		}
+		ResultList->addItem(Item);
+	}
+
+	if (ResultList->count())
+	{
+		ResultList->setCurrentRow(0);
+	}
+}
+
+
+//============================================================================
+void DockQuickSwitcherPrivate::moveCurrentRow(int Offset)
+{
+	int Count = ResultList->count();
+	if (!Count)
+	{
+		return;
+	}
+
+	int Row = (ResultList->currentRow() + Offset + Count) % Count;
+	ResultList->setCurrentRow(Row);
+}
+
+
+//============================================================================
+CDockQuickSwitcher::CDockQuickSwitcher(CDockManager* DockManager) :
+	Super(DockManager, Qt::Popup),
+	d(new DockQuickSwitcherPrivate(this))
+{
+	d->DockManager = DockManager;
+	setFrameShape(QFrame::StyledPanel);
+	d->createContent();
+}
+
+
+//============================================================================
+CDockQuickSwitcher::~CDockQuickSwitcher()
+{
+	delete d;
+}
+
+
+//============================================================================
+int CDockQuickSwitcher::maxResultCount() const
+{
+	return d->MaxResultCount;
+}
+
+
+//============================================================================
+void CDockQuickSwitcher::setMaxResultCount(int Count)
+{
+	d->MaxResultCount = Count;
+}
+
+
+//============================================================================
+void CDockQuickSwitcher::onTextChanged(const QString& Text)
+{
+	d->updateResults(Text);
+}
+
+
+//============================================================================
+void CDockQuickSwitcher::onItemActivated()
+{
+	int Row = d->ResultList->currentRow();
+	CDockWidget* DockWidget = (Row >= 0 && Row < d->Results.count())
+		? d->Results[Row].data() : nullptr;
+	hide();
+	if (!DockWidget)
+	{
+		return;
+	}
+
+	DockWidget->toggleView(true);
+	DockWidget->raise();
+	emit dockWidgetActivated(DockWidget);
+}
+
+
+//============================================================================
+void CDockQuickSwitcher::showEvent(QShowEvent* event)
+{
+	Super::showEvent(event);
+	// Clearing a non empty search edit triggers onTextChanged()
+	if (d->SearchEdit->text().isEmpty())
+	{
+		d->updateResults(QString());
+	}
+	else
+	{
+		d->SearchEdit->clear();
+	}
+	d->SearchEdit->setFocus(Qt::PopupFocusReason);
+}
+
+
+//============================================================================
+bool CDockQuickSwitcher::eventFilter(QObject* watched, QEvent* event)
+{
+	if (watched != d->SearchEdit || event->type() != QEvent::KeyPress)
+	{
+		return Super::eventFilter(watched, event);
+	}
+
+	QKeyEvent* KeyEvent = static_cast<QKeyEvent*>(event);
+	switch (KeyEvent->key())
+	{
+	case Qt::Key_Down:
+		d->moveCurrentRow(1);
+		return true;
+
+	case Qt::Key_Up:
+		d->moveCurrentRow(-1);
+		return true;
+
+	case Qt::Key_Escape:
+		hide();
+		return true;
+
+	default:
+		break;
+	}
+
+	return Super::eventFilter(watched, event);
+}
+
+} // namespace ads
+
+//---------------------------------------------------------------------------
+// EOF DockQuickSwitcher.cpp
@@ -0,0 +1,98 @@
+#ifndef DockQuickSwitcherH
+#define DockQuickSwitcherH
+/*******************************************************************************
+** Qt Advanced Docking System
+** Copyright (C) 2017 Uwe Kindler
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 2.1 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+
+//============================================================================
+/// \file   DockQuickSwitcher.h
+/// \author Uwe Kindler
+/// \date   19.10.2026
+/// \brief  Declaration of CDockQuickSwitcher class
+//============================================================================
+
+
+//============================================================================
+//                                   INCLUDES
+//============================================================================
+#include <QFrame>
+
+#include "ads_globals.h"
+
+namespace ads
+{
+class CDockManager;
+class CDockWidget;
+struct DockQuickSwitcherPrivate;
+
+/**
+ * Popup with a search line edit and a result list that lets the user
+ * jump to any dock widget of a dock manager by typing a part of its title,
+ * object name or view menu group.
+ * The popup queries the search index of the dock manager on each key
+ * stroke. Activating a result opens and raises the dock widget.
+ */
+class ADS_EXPORT CDockQuickSwitcher : public QFrame
+{
+	Q_OBJECT
+private:
+	DockQuickSwitcherPrivate* d; ///< private data (pimpl)
+	friend struct DockQuickSwitcherPrivate;
+
+private slots:
+	void onTextChanged(const QString& Text);
+	void onItemActivated();
+
+protected:
+	virtual bool eventFilter(QObject* watched, QEvent* event) override;
+	virtual void showEvent(QShowEvent* event) override;
+
+public:
+	using Super = QFrame;
+
+	/**
+	 * Creates the popup for the given dock manager
+	 */
+	CDockQuickSwitcher(CDockManager* DockManager);
+
+	/**
+	 * Virtual Destructor
+	 */
+	virtual ~CDockQuickSwitcher();
+
+	/**
+	 * Maximum number of results shown in the result list.
+	 * The default value is 20
+	 */
+	int maxResultCount() const;
+
+	/**
+	 * Sets the maximum number of results shown in the result list
+	 */
+	void setMaxResultCount(int Count);
+
+signals:
+	/**
+	 * This signal is emitted if the user activated the given dock widget
+	 */
+	void dockWidgetActivated(ads::CDockWidget* DockWidget);
+}; // class DockQuickSwitcher
+} // namespace ads
+
+//---------------------------------------------------------------------------
+#endif // DockQuickSwitcherH
@@ -31,11 +31,18 @@
 
 #include <QDebug>
 #include <QChildEvent>
+#include <QElapsedTimer>
+#include <QMouseEvent>
+#include <QPointer>
+#include <QTimer>
 
 #include "DockAreaWidget.h"
+#include "DockWidget.h"
 
 namespace ads
 {
+class CDockSplitterHandle;
+
 /**
  * Private dock splitter data
  */
@@ -43,10 +50,166 @@ struct DockSplitterPrivate
 {
 	CDockSplitter* _this;
 	int VisibleContentCount = 0;
+	int LiveResizeInterval = 0;
+	QTimer* LiveResizeTimer = nullptr;
+	QElapsedTimer LastLiveResize;
+	int PendingPos = 0;
+	QPointer<CDockSplitterHandle> PendingHandle;
+	double LastResizeDuration = 0;
+	double AverageResizeDuration = 0;
+	internal::CResizeBurst ResizeBurst;
 
 	DockSplitterPrivate(CDockSplitter* _public) : _this(_public) {}
+
+	/**
+	 * Stores the given splitter position and applies it immediately if the
+	 * live resize interval has elapsed. Otherwise the position is applied
+	 * by the live resize timer
+	 */
+	void scheduleMove(int Pos, CDockSplitterHandle* Handle);
+
+	/**
+	 * Applies the pending splitter position and measures how long this
+	 * takes
+	 */
+	void applyPendingMove();
+
+	/**
+	 * Starts a resize burst for all dock widgets in this splitter
+	 */
+	void beginResizeBurst();
+};
+
+
+/**
+ * Splitter handle that forwards the mouse moves to the rate limited live
+ * resizing of its splitter. If the live resize mode is disabled, the handle
+ * works like a normal QSplitterHandle.
+ */
+class CDockSplitterHandle : public QSplitterHandle
+{
+private:
+	int MouseOffset = 0;
+
+	CDockSplitter* dockSplitter() const
+	{
+		return static_cast<CDockSplitter*>(splitter());
+	}
+
+	int pick(const QPoint& Pos) const
+	{
+		return (orientation() == Qt::Horizontal) ? Pos.x() : Pos.y();
+	}
+
+public:
+	using Super = QSplitterHandle;
+
+	CDockSplitterHandle(Qt::Orientation Orientation, CDockSplitter* Parent)
+		: QSplitterHandle(Orientation, Parent)
+	{}
+
+	/**
+	 * Moves the handle to the given position. QSplitterHandle::moveSplitter()
+	 * mirrors the position for horizontal right-to-left splitters
+	 */
+	void applyMove(int Pos)
+	{
+		moveSplitter(Pos);
+	}
+
+protected:
+	virtual void mousePressEvent(QMouseEvent* e) override
+	{
+		if (e->button() == Qt::LeftButton)
+		{
+			MouseOffset = pick(e->pos());
+			dockSplitter()->d->beginResizeBurst();
+		}
+		Super::mousePressEvent(e);
+	}
+
+	virtual void mouseMoveEvent(QMouseEvent* e) override
+	{
+		auto d = dockSplitter()->d;
+		if (!d->LiveResizeInterval || !(e->buttons() & Qt::LeftButton))
+		{
+			Super::mouseMoveEvent(e);
+			return;
+		}
+
+		// Same position calculation as QSplitterHandle::mouseMoveEvent()
+		int Pos = pick(parentWidget()->mapFromGlobal(e->globalPos())) - MouseOffset;
+		d->scheduleMove(Pos, this);
+	}
+
+	virtual void mouseReleaseEvent(QMouseEvent* e) override
+	{
+		auto d = dockSplitter()->d;
+		if (d->LiveResizeInterval && e->button() == Qt::LeftButton)
+		{
+			d->applyPendingMove();
+		}
+		Super::mouseReleaseEvent(e);
+		if (e->button() == Qt::LeftButton)
+		{
+			d->ResizeBurst.end();
+		}
+	}
 };
 
+
+//============================================================================
+void DockSplitterPrivate::scheduleMove(int Pos, CDockSplitterHandle* Handle)
+{
+	PendingPos = Pos;
+	PendingHandle = Handle;
+	int Interval = _this->effectiveLiveResizeInterval();
+	qint64 Elapsed = LastLiveResize.isValid() ? LastLiveResize.elapsed() : Interval;
+	if (Elapsed >= Interval)
+	{
+		applyPendingMove();
+	}
+	else if (!LiveResizeTimer->isActive())
+	{
+		LiveResizeTimer->start(Interval - Elapsed);
+	}
+}
+
+
+//============================================================================
+void DockSplitterPrivate::beginResizeBurst()
+{
+	// Only the current dock widget of a dock area has a parent, so we
+	// collect the dock widgets via the dock areas
+	QList<CDockWidget*> DockWidgets;
+	for (auto DockArea : _this->findChildren<CDockAreaWidget*>())
+	{
+		DockWidgets.append(DockArea->dockWidgets());
+	}
+	ResizeBurst.begin(DockWidgets);
+}
+
+
+//============================================================================
+void DockSplitterPrivate::applyPendingMove()
+{
+	LiveResizeTimer->stop();
+	if (!PendingHandle)
+	{
+		return;
+	}
+
+	QElapsedTimer Timer;
+	Timer.start();
+	PendingHandle->applyMove(PendingPos);
+	LastResizeDuration = Timer.nsecsElapsed() / 1000000.0;
+	AverageResizeDuration = (AverageResizeDuration > 0)
+		? (0.8 * AverageResizeDuration + 0.2 * LastResizeDuration)
+		: LastResizeDuration;
+	LastLiveResize.start();
+	PendingHandle = nullptr;
+}
+
 //============================================================================
 CDockSplitter::CDockSplitter(QWidget *parent)
 	: QSplitter(parent),
@@ -102,6 +265,66 @@ QWidget* CDockSplitter::lastWidget() const
 	return (count() > 0) ? widget(count() - 1) : nullptr;
 }
 
+
+//============================================================================
+QSplitterHandle* CDockSplitter::createHandle()
+{
+	return new CDockSplitterHandle(orientation(), this);
+}
+
+
+//============================================================================
+void CDockSplitter::setLiveResizeInterval(int Milliseconds)
+{
+	d->LiveResizeInterval = qMax(0, Milliseconds);
+	if (!d->LiveResizeInterval)
+	{
+		return;
+	}
+
+	// The live resize mode moves the widgets like the opaque mode, just
+	// less often
+	setOpaqueResize(true);
+	if (!d->LiveResizeTimer)
+	{
+		d->LiveResizeTimer = new QTimer(this);
+		d->LiveResizeTimer->setSingleShot(true);
+		connect(d->LiveResizeTimer, &QTimer::timeout, [this]()
+		{
+			d->applyPendingMove();
+		});
+	}
+}
+
+
+//============================================================================
+int CDockSplitter::liveResizeInterval() const
+{
+	return d->LiveResizeInterval;
+}
+
+
+//============================================================================
+int CDockSplitter::effectiveLiveResizeInterval() const
+{
+	// We do not want to spend more than half of the time for relayouting
+	return qMax(d->LiveResizeInterval, qRound(d->AverageResizeDuration * 2));
+}
+
+
+//============================================================================
+double CDockSplitter::lastResizeDuration() const
+{
+	return d->LastResizeDuration;
+}
+
+
+//============================================================================
+double CDockSplitter::averageResizeDuration() const
+{
+	return d->AverageResizeDuration;
+}
+
 } // namespace ads
 
 //---------------------------------------------------------------------------
@@ -47,6 +47,13 @@ class ADS_EXPORT CDockSplitter : public QSplitter
 private:
 	DockSplitterPrivate* d;
 	friend struct DockSplitterPrivate;
+	friend class CDockSplitterHandle;
+
+protected:
+	/**
+	 * Creates the handles that implement the rate limited live resizing
+	 */
+	virtual QSplitterHandle* createHandle() override;
 
 public:
 	CDockSplitter(QWidget *parent = Q_NULLPTR);
@@ -71,6 +78,44 @@ public:
 	 * Returns last widget of nullptr is splitter is empty
 	 */
 	QWidget* lastWidget() const;
+
+	/**
+	 * Enables the rate limited live resize mode if Milliseconds is > 0.
+	 * In this mode, the splitter works like an opaque splitter, but the
+	 * sizes are applied at most once per interval while the user drags
+	 * a splitter handle. The final position is always applied when the
+	 * mouse is released. If applying the sizes takes longer than half of
+	 * the interval, i.e. because the relayout of the content is expensive,
+	 * the interval is increased automatically. A value of 0 disables the
+	 * live resize mode. The opaque resize mode is not changed then.
+	 */
+	void setLiveResizeInterval(int Milliseconds);
+
+	/**
+	 * Returns the configured live resize interval in milliseconds or 0 if
+	 * the live resize mode is disabled
+	 */
+	int liveResizeInterval() const;
+
+	/**
+	 * Returns the live resize interval that is currently used. This is the
+	 * configured interval or a longer interval if applying the sizes is
+	 * expensive.
+	 */
+	int effectiveLiveResizeInterval() const;
+
+	/**
+	 * Returns the time in milliseconds that the last live resize step
+	 * took. The relayout of the content in posted layout requests is not
+	 * included
+	 */
+	double lastResizeDuration() const;
+
+	/**
+	 * Returns the exponentially smoothed time in milliseconds that the
+	 * live resize steps took
+	 */
+	double averageResizeDuration() const;
 }; // class CDockSplitter
 
 } // namespace ads
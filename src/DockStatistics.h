@@ -0,0 +1,128 @@
+#ifndef DockStatisticsH
+#define DockStatisticsH
+/*******************************************************************************
+** Qt Advanced Docking System
+** Copyright (C) 2017 Uwe Kindler
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 2.1 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+
+//============================================================================
+/// \file   DockStatistics.h
+/// \author Uwe Kindler
+/// \date   19.10.2026
+/// \brief  Declaration of the dock manager statistics structures
+//============================================================================
+
+
+//============================================================================
+//                                   INCLUDES
+//============================================================================
+#include "ads_globals.h"
+
+#include <QElapsedTimer>
+
+namespace ads
+{
+/**
+ * Timing statistics of one kind of docking operation.
+ * All times are given in nanoseconds.
+ */
+struct CDockTimingStatistics
+{
+	int CallCount = 0; ///< number of recorded calls
+	qint64 TotalNsecs = 0; ///< cumulative time of all recorded calls
+	qint64 LastNsecs = 0; ///< time of the last recorded call
+
+	/**
+	 * Records one call with the given duration
+	 */
+	void record(qint64 Nsecs)
+	{
+		CallCount++;
+		TotalNsecs += Nsecs;
+		LastNsecs = Nsecs;
+	}
+};
+
+
+/**
+ * Statistics of a dock manager returned by CDockManager::statistics().
+ * The structure counts are calculated when the statistics are requested.
+ * The timings and event counters are only recorded if statistics are
+ * enabled via CDockManager::setStatisticsEnabled().
+ */
+struct CDockManagerStatistics
+{
+	int ContainerCount = 0; ///< dock manager and all floating containers
+	int FloatingContainerCount = 0; ///< floating containers
+	int DockAreaCount = 0; ///< dock areas in all containers
+	int SplitterCount = 0; ///< splitters in all containers
+	int MaxSplitterDepth = 0; ///< maximum splitter tree depth of all containers
+	int DockWidgetCount = 0; ///< registered dock widgets
+	int OpenDockWidgetCount = 0; ///< registered dock widgets that are not closed
+
+	CDockTimingStatistics SaveState; ///< CDockManager::saveState()
+	CDockTimingStatistics RestoreState; ///< CDockManager::restoreState()
+	CDockTimingStatistics OpenPerspective; ///< CDockManager::openPerspective()
+	CDockTimingStatistics Drop; ///< dropping dock widgets or floating widgets into a container
+	CDockTimingStatistics OverlayUpdate; ///< drop overlay updates while dragging
+
+	int LayoutMutationCount = 0; ///< added, removed and toggled dock areas
+	int TopLevelSignalCount = 0; ///< emitted CDockWidget::topLevelChanged() signals
+};
+
+
+namespace internal
+{
+/**
+ * Records the lifetime of this object in the given timing statistics.
+ * If Statistics is a nullptr, because the statistics are disabled, the
+ * object does nothing.
+ * \code
+ * internal::CScopedTiming Timing(Statistics ? &Statistics->Drop : nullptr);
+ * \endcode
+ */
+class CScopedTiming
+{
+private:
+	CDockTimingStatistics* Statistics;
+	QElapsedTimer Timer;
+
+public:
+	CScopedTiming(CDockTimingStatistics* Statistics)
+		: Statistics(Statistics)
+	{
+		if (Statistics)
+		{
+			Timer.start();
+		}
+	}
+
+	~CScopedTiming()
+	{
+		if (Statistics)
+		{
+			Statistics->record(Timer.nsecsElapsed());
+		}
+	}
+
+	Q_DISABLE_COPY(CScopedTiming)
+};
+} // namespace internal
+} // namespace ads
+
+//---------------------------------------------------------------------------
+#endif // DockStatisticsH
@@ -0,0 +1,324 @@
+/*******************************************************************************
+** Qt Advanced Docking System
+** Copyright (C) 2017 Uwe Kindler
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 2.1 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+
+//============================================================================
+/// \file   DockTrace.cpp
+/// \author Uwe Kindler
+/// \date   19.10.2026
+/// \brief  Implementation of CDockTrace class
+//============================================================================
+
+
+//============================================================================
+//                                   INCLUDES
+//============================================================================
+#include "DockTrace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QThread>
+
+
+namespace ads
+{
+static const int DefaultBufferCapacity = 1 << 16;
+
+/**
+ * One slot of the ring buffer.
+ * Sequence is odd while a writer fills the slot and 2 * (Index + 1) if the
+ * slot contains the event with the given write index. All fields are
+ * atomics, so that the exporting thread can read a slot while another
+ * thread overwrites it and detect this via the sequence number.
+ */
+struct TraceEvent
+{
+	std::atomic<quint64> Sequence{0};
+	std::atomic<const char*> Name{nullptr};
+	std::atomic<qint64> StartNsecs{0};
+	std::atomic<qint64> DurationNsecs{0};
+	std::atomic<quintptr> ThreadId{0};
+};
+
+
+/**
+ * Plain copy of a trace event for the export
+ */
+struct TraceEventData
+{
+	const char* Name;
+	qint64 StartNsecs;
+	qint64 DurationNsecs;
+	quintptr ThreadId;
+};
+
+
+/**
+ * The global ring buffer. Writers claim a slot via an atomic increment of
+ * the write index, so recording an event never blocks.
+ */
+struct TraceBuffer
+{
+	std::atomic<bool> Enabled{false};
+	std::atomic<quint64> WriteIndex{0};
+	std::unique_ptr<TraceEvent[]> Events;
+	quint64 Capacity = DefaultBufferCapacity;
+
+	void allocate()
+	{
+		if (!Events)
+		{
+			Events.reset(new TraceEvent[Capacity]);
+			WriteIndex.store(0, std::memory_order_relaxed);
+		}
+	}
+};
+static TraceBuffer Buffer;
+
+
+//============================================================================
+static void appendJsonString(QByteArray& Json, const char* Text)
+{
+	Json.append('"');
+	for (const char* c = Text; *c; ++c)
+	{
+		switch (*c)
+		{
+		case '"': Json.append("\\\""); break;
+		case '\\': Json.append("\\\\"); break;
+		default:
+			if (uchar(*c) < 0x20)
+			{
+				Json.append(QByteArray("\\u00") + QByteArray::number(uchar(*c), 16)
+					.rightJustified(2, '0'));
+			}
+			else
+			{
+				Json.append(*c);
+			}
+			break;
+		}
+	}
+	Json.append('"');
+}
+
+
+//============================================================================
+static QByteArray microseconds(qint64 Nsecs)
+{
+	return QByteArray::number(Nsecs / 1000) + '.'
+		+ QByteArray::number(Nsecs % 1000).rightJustified(3, '0');
+}
+
+
+//============================================================================
+void CDockTrace::setEnabled(bool Enabled)
+{
+	if (Enabled)
+	{
+		Buffer.allocate();
+	}
+	Buffer.Enabled.store(Enabled, std::memory_order_release);
+}
+
+
+//============================================================================
+bool CDockTrace::isEnabled()
+{
+	return Buffer.Enabled.load(std::memory_order_relaxed);
+}
+
+
+//============================================================================
+void CDockTrace::setBufferCapacity(int Capacity)
+{
+	quint64 PowerOfTwo = 1;
+	while (PowerOfTwo < quint64(qMax(1, Capacity)))
+	{
+		PowerOfTwo <<= 1;
+	}
+	Buffer.Capacity = PowerOfTwo;
+	Buffer.Events.reset();
+	if (isEnabled())
+	{
+		Buffer.allocate();
+	}
+}
+
+
+//============================================================================
+int CDockTrace::bufferCapacity()
+{
+	return int(Buffer.Capacity);
+}
+
+
+//============================================================================
+void CDockTrace::clear()
+{
+	if (!Buffer.Events)
+	{
+		return;
+	}
+
+	for (quint64 i = 0; i < Buffer.Capacity; ++i)
+	{
+		Buffer.Events[i].Sequence.store(0, std::memory_order_relaxed);
+	}
+	Buffer.WriteIndex.store(0, std::memory_order_release);
+}
+
+
+//============================================================================
+qint64 CDockTrace::timestamp()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+//============================================================================
+void CDockTrace::addEvent(const char* Name, qint64 StartNsecs, qint64 DurationNsecs)
+{
+	if (!Buffer.Enabled.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	quint64 Index = Buffer.WriteIndex.fetch_add(1, std::memory_order_relaxed);
+	TraceEvent& Event = Buffer.Events[Index & (Buffer.Capacity - 1)];
+	Event.Sequence.store(2 * Index + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	Event.Name.store(Name, std::memory_order_relaxed);
+	Event.StartNsecs.store(StartNsecs, std::memory_order_relaxed);
+	Event.DurationNsecs.store(DurationNsecs, std::memory_order_relaxed);
+	Event.ThreadId.store(quintptr(QThread::currentThreadId()), std::memory_order_relaxed);
+	Event.Sequence.store(2 * (Index + 1), std::memory_order_release);
+}
+
+
+//============================================================================
+QByteArray CDockTrace::toJson()
+{
+	std::vector<TraceEventData> Events;
+	if (Buffer.Events)
+	{
+		quint64 End = Buffer.WriteIndex.load(std::memory_order_acquire);
+		quint64 Begin = (End > Buffer.Capacity) ? End - Buffer.Capacity : 0;
+		Events.reserve(End - Begin);
+		for (quint64 Index = Begin; Index < End; ++Index)
+		{
+			const TraceEvent& Event = Buffer.Events[Index & (Buffer.Capacity - 1)];
+			quint64 Sequence = Event.Sequence.load(std::memory_order_acquire);
+			TraceEventData Data{Event.Name.load(std::memory_order_relaxed),
+				Event.StartNsecs.load(std::memory_order_relaxed),
+				Event.DurationNsecs.load(std::memory_order_relaxed),
+				Event.ThreadId.load(std::memory_order_relaxed)};
+			std::atomic_thread_fence(std::memory_order_acquire);
+			// Skip slots that are written or have been overwritten while
+			// we read them
+			if (Sequence != 2 * (Index + 1)
+			 || Event.Sequence.load(std::memory_order_relaxed) != Sequence
+			 || !Data.Name)
+			{
+				continue;
+			}
+			Events.push_back(Data);
+		}
+	}
+
+	std::sort(Events.begin(), Events.end(),
+		[](const TraceEventData& a, const TraceEventData& b)
+		{
+			return a.StartNsecs < b.StartNsecs;
+		});
+
+	const QByteArray Pid = QByteArray::number(QCoreApplication::applicationPid());
+	QByteArray Json;
+	Json.reserve(int(Events.size()) * 96 + 64);
+	Json.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+	bool First = true;
+	for (const auto& Event : Events)
+	{
+		if (!First)
+		{
+			Json.append(",\n");
+		}
+		First = false;
+		Json.append("{\"name\":");
+		appendJsonString(Json, Event.Name);
+		Json.append(",\"cat\":\"ads\",\"ph\":\"X\",\"ts\":");
+		Json.append(microseconds(Event.StartNsecs));
+		Json.append(",\"dur\":");
+		Json.append(microseconds(Event.DurationNsecs));
+		Json.append(",\"pid\":");
+		Json.append(Pid);
+		Json.append(",\"tid\":");
+		Json.append(QByteArray::number(quint64(Event.ThreadId)));
+		Json.append('}');
+	}
+	Json.append("]}\n");
+	return Json;
+}
+
+
+//============================================================================
+bool CDockTrace::saveJson(const QString& FileName)
+{
+	QFile File(FileName);
+	if (!File.open(QIODevice::WriteOnly | QIODevice::Truncate))
+	{
+		return false;
+	}
+
+	return File.write(toJson()) >= 0;
+}
+
+
+namespace internal
+{
+//============================================================================
+CTraceScope::CTraceScope(const char* Name)
+	: Name(Name)
+{
+	if (CDockTrace::isEnabled())
+	{
+		StartNsecs = CDockTrace::timestamp();
+	}
+}
+
+
+//============================================================================
+CTraceScope::~CTraceScope()
+{
+	if (StartNsecs >= 0)
+	{
+		CDockTrace::addEvent(Name, StartNsecs, CDockTrace::timestamp() - StartNsecs);
+	}
+}
+} // namespace internal
+} // namespace ads
+
+//---------------------------------------------------------------------------
+// EOF DockTrace.cpp
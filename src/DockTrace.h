@@ -0,0 +1,150 @@
+#ifndef DockTraceH
+#define DockTraceH
+/*******************************************************************************
+** Qt Advanced Docking System
+** Copyright (C) 2017 Uwe Kindler
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 2.1 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+
+//============================================================================
+/// \file   DockTrace.h
+/// \author Uwe Kindler
+/// \date   19.10.2026
+/// \brief  Declaration of CDockTrace class
+//============================================================================
+
+
+//============================================================================
+//                                   INCLUDES
+//============================================================================
+#include "ads_globals.h"
+
+#include <QByteArray>
+#include <QString>
+
+namespace ads
+{
+/**
+ * Records the duration of the docking hot paths (restoring the state,
+ * dropping, overlay updates, tab switching...) into a lock-free ring buffer
+ * and exports the recorded events in the Chrome trace event JSON format.
+ * The exported file can be opened in chrome://tracing or in the Perfetto UI.
+ *
+ * The timestamps come from the monotonic system clock (CLOCK_MONOTONIC on
+ * Linux), so they can be merged with the traces of the application if the
+ * application uses the same clock - e.g. via timestamp() and addEvent().
+ *
+ * Tracing is disabled by default. If it is disabled, each trace point costs
+ * one atomic load. Define ADS_NO_TRACE to remove all trace points at
+ * compile time.
+ * \code
+ * ads::CDockTrace::setEnabled(true);
+ * ...
+ * ads::CDockTrace::saveJson("docking_trace.json");
+ * \endcode
+ */
+class ADS_EXPORT CDockTrace
+{
+public:
+	/**
+	 * Enables or disables the recording of trace events.
+	 * The ring buffer is allocated when tracing is enabled for the first
+	 * time.
+	 */
+	static void setEnabled(bool Enabled);
+
+	/**
+	 * Returns true if trace events are recorded
+	 */
+	static bool isEnabled();
+
+	/**
+	 * Sets the number of events the ring buffer can hold. If the buffer is
+	 * full, the oldest events are overwritten. The capacity is rounded up
+	 * to the next power of two and the default capacity is 65536 events.
+	 * Changing the capacity clears the buffer. Call this function only while
+	 * tracing is disabled.
+	 */
+	static void setBufferCapacity(int Capacity);
+
+	/**
+	 * Returns the number of events the ring buffer can hold
+	 */
+	static int bufferCapacity();
+
+	/**
+	 * Removes all recorded events. Call this function only while
+	 * tracing is disabled.
+	 */
+	static void clear();
+
+	/**
+	 * Returns the current time of the trace clock in nanoseconds
+	 */
+	static qint64 timestamp();
+
+	/**
+	 * Records a complete event with the given name, start time and duration.
+	 * The Name needs to stay valid until the events are exported - normally
+	 * it is a string literal.
+	 * Does nothing if tracing is disabled.
+	 */
+	static void addEvent(const char* Name, qint64 StartNsecs, qint64 DurationNsecs);
+
+	/**
+	 * Returns all recorded events as trace event JSON document
+	 */
+	static QByteArray toJson();
+
+	/**
+	 * Writes the trace event JSON document into the file with the given
+	 * FileName. Returns false if the file could not be written.
+	 */
+	static bool saveJson(const QString& FileName);
+};
+
+
+namespace internal
+{
+/**
+ * Records the lifetime of this object as trace event with the given name.
+ * Use the ADS_TRACE_SCOPE macro instead of using this class directly.
+ */
+class ADS_EXPORT CTraceScope
+{
+private:
+	const char* Name;
+	qint64 StartNsecs = -1;
+
+public:
+	CTraceScope(const char* Name);
+	~CTraceScope();
+	Q_DISABLE_COPY(CTraceScope)
+};
+} // namespace internal
+} // namespace ads
+
+#define ADS_TRACE_CONCAT_(a, b) a##b
+#define ADS_TRACE_CONCAT(a, b) ADS_TRACE_CONCAT_(a, b)
+
+#ifdef ADS_NO_TRACE
+#define ADS_TRACE_SCOPE(Name)
+#else
+#define ADS_TRACE_SCOPE(Name) ads::internal::CTraceScope ADS_TRACE_CONCAT(TraceScope, __LINE__)(Name)
+#endif
+
+//---------------------------------------------------------------------------
+#endif // DockTraceH
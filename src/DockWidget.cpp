@@ -35,6 +35,8 @@
 
 #include <QBoxLayout>
 #include <QAction>
+#include <QAbstractButton>
+#include <QLabel>
 #include <QSplitter>
 #include <QStack>
 #include <QScrollArea>
@@ -52,6 +54,7 @@
 
 #include "DockContainerWidget.h"
 #include "DockAreaWidget.h"
+#include "DockAreaTitleBar.h"
 #include "DockManager.h"
 #include "FloatingDockContainer.h"
 #include "DockSplitter.h"
@@ -61,6 +64,19 @@
 
 namespace ads
 {
+/**
+ * Toolbar style settings of a dock widget. The settings are allocated only
+ * if they differ from the defaults
+ */
+struct DockWidgetToolBarSettings
+{
+	Qt::ToolButtonStyle StyleDocked = Qt::ToolButtonIconOnly;
+	Qt::ToolButtonStyle StyleFloating = Qt::ToolButtonTextUnderIcon;
+	QSize IconSizeDocked = QSize(16, 16);
+	QSize IconSizeFloating = QSize(24, 24);
+};
+static const DockWidgetToolBarSettings DefaultToolBarSettings;
+
 /**
  * Private data class of CDockWidget class (pimpl)
  */
@@ -69,7 +85,7 @@ struct DockWidgetPrivate
 	CDockWidget* _this = nullptr;
 	QBoxLayout* Layout = nullptr;
 	QWidget* Widget = nullptr;
-	CDockWidgetTab* TabWidget = nullptr;
+	QPointer<CDockWidgetTab> TabWidget;
 	CDockWidget::DockWidgetFeatures Features = CDockWidget::DefaultDockWidgetFeatures;
 	CDockManager* DockManager = nullptr;
 	CDockAreaWidget* DockArea = nullptr;
@@ -77,11 +93,10 @@ struct DockWidgetPrivate
 	bool Closed = false;
 	QScrollArea* ScrollArea = nullptr;
 	QToolBar* ToolBar = nullptr;
-	Qt::ToolButtonStyle ToolBarStyleDocked = Qt::ToolButtonIconOnly;
-	Qt::ToolButtonStyle ToolBarStyleFloating = Qt::ToolButtonTextUnderIcon;
-	QSize ToolBarIconSizeDocked = QSize(16, 16);
-	QSize ToolBarIconSizeFloating = QSize(24, 24);
+	DockWidgetToolBarSettings* ToolBarSettings = nullptr;
+	CDockWidget::eToggleViewActionMode ToggleViewActionMode = CDockWidget::ActionModeToggle;
 	bool IsFloatingTopLevel = false;
+	int ResizeBurstCount = 0;
 	QList<QAction*> TitleBarActions;
 	CDockWidget::eMinimumSizeHintMode MinimumSizeHintMode = CDockWidget::MinimumSizeHintFromDockWidget;
 
@@ -90,6 +105,56 @@ struct DockWidgetPrivate
 	 */
 	DockWidgetPrivate(CDockWidget* _public);
 
+	/**
+	 * Private data destructor
+	 */
+	~DockWidgetPrivate();
+
+	/**
+	 * Returns the layout and creates it, if it does not exist yet
+	 */
+	QBoxLayout* contentLayout();
+
+	/**
+	 * Returns the tab widget and creates it, if it does not exist yet
+	 */
+	CDockWidgetTab* tabWidget();
+
+	/**
+	 * Returns the toggle view action and creates it, if it does not exist yet.
+	 * The state of a lazily created action is derived from the dock widget
+	 * state.
+	 */
+	QAction* toggleViewAction();
+
+	/**
+	 * Checks or unchecks the toggle view action without triggering it.
+	 * Does nothing if the action does not exist yet.
+	 */
+	void setToggleViewActionChecked(bool Checked);
+
+	/**
+	 * Returns the toolbar settings or the default settings, if no custom
+	 * settings have been assigned
+	 */
+	const DockWidgetToolBarSettings& toolBarSettings() const
+	{
+		return ToolBarSettings ? *ToolBarSettings : DefaultToolBarSettings;
+	}
+
+	/**
+	 * Returns the toolbar settings for modification. The settings are
+	 * allocated on first call
+	 */
+	DockWidgetToolBarSettings& customToolBarSettings()
+	{
+		if (!ToolBarSettings)
+		{
+			ToolBarSettings = new DockWidgetToolBarSettings();
+		}
+		return *ToolBarSettings;
+	}
+
 	/**
 	 * Show dock widget
 	 */
@@ -127,6 +192,77 @@ DockWidgetPrivate::DockWidgetPrivate(CDockWidget* _public) :
 }
 
 
+//============================================================================
+DockWidgetPrivate::~DockWidgetPrivate()
+{
+	delete ToolBarSettings;
+}
+
+
+//============================================================================
+QBoxLayout* DockWidgetPrivate::contentLayout()
+{
+	if (!Layout)
+	{
+		Layout = new QBoxLayout(QBoxLayout::TopToBottom);
+		Layout->setContentsMargins(0, 0, 0, 0);
+		Layout->setSpacing(0);
+		_this->setLayout(Layout);
+	}
+	return Layout;
+}
+
+
+//============================================================================
+CDockWidgetTab* DockWidgetPrivate::tabWidget()
+{
+	if (!TabWidget)
+	{
+		TabWidget = componentsFactory()->createDockWidgetTab(_this);
+	}
+	return TabWidget;
+}
+
+
+//============================================================================
+QAction* DockWidgetPrivate::toggleViewAction()
+{
+	if (ToggleViewAction)
+	{
+		return ToggleViewAction;
+	}
+
+	ToggleViewAction = new QAction(_this->windowTitle(), _this);
+	ToggleViewAction->setCheckable(true);
+	if (CDockWidget::ActionModeShow == ToggleViewActionMode)
+	{
+		ToggleViewAction->setCheckable(false);
+		ToggleViewAction->setIcon(_this->icon());
+	}
+	if (TabWidget)
+	{
+		ToggleViewAction->setToolTip(TabWidget->toolTip());
+	}
+	ToggleViewAction->setChecked(DockArea != nullptr && !Closed);
+	_this->connect(ToggleViewAction, SIGNAL(triggered(bool)), SLOT(toggleView(bool)));
+	return ToggleViewAction;
+}
+
+
+//============================================================================
+void DockWidgetPrivate::setToggleViewActionChecked(bool Checked)
+{
+	if (!ToggleViewAction)
+	{
+		return;
+	}
+
+	ToggleViewAction->blockSignals(true);
+	ToggleViewAction->setChecked(Checked);
+	ToggleViewAction->blockSignals(false);
+}
+
+
 //============================================================================
 void DockWidgetPrivate::showDockWidget()
 {
@@ -140,7 +276,7 @@ void DockWidgetPrivate::showDockWidget()
 	{
 		DockArea->setCurrentDockWidget(_this);
 		DockArea->toggleView(true);
-		TabWidget->show();
+		tabWidget()->show();
 		QSplitter* Splitter = internal::findParent<QSplitter*>(DockArea);
 		while (Splitter && !Splitter->isVisible())
 		{
@@ -162,7 +298,10 @@ void DockWidgetPrivate::showDockWidget()
 //============================================================================
 void DockWidgetPrivate::hideDockWidget()
 {
-	TabWidget->hide();
+	if (TabWidget)
+	{
+		TabWidget->hide();
+	}
 	updateParentDockArea();
 }
 
@@ -193,12 +332,74 @@ void DockWidgetPrivate::updateParentDockArea()
 }
 
 
+//============================================================================
+/**
+ * Adds the given object and all its children to the footprint. The
+ * subtree of the Exclude object is not counted. If PartCount is given, it
+ * is incremented for each counted object
+ */
+static void addToFootprint(QObject* Object, QObject* Exclude,
+	CDockWidgetFootprint& Footprint, int* PartCount = nullptr)
+{
+	if (!Object || Object == Exclude)
+	{
+		return;
+	}
+
+	Footprint.ObjectCount++;
+	Footprint.WidgetCount += Object->isWidgetType() ? 1 : 0;
+	if (qobject_cast<QLabel*>(Object))
+	{
+		Footprint.LabelCount++;
+	}
+	else if (qobject_cast<QAbstractButton*>(Object))
+	{
+		Footprint.ButtonCount++;
+	}
+	else if (qobject_cast<QAction*>(Object))
+	{
+		Footprint.ActionCount++;
+	}
+
+	if (PartCount)
+	{
+		++*PartCount;
+	}
+
+	for (auto Child : Object->children())
+	{
+		addToFootprint(Child, Exclude, Footprint, PartCount);
+	}
+}
+
+
+//============================================================================
+/**
+ * Adds the given application content object and all its children to the
+ * content counts of the footprint
+ */
+static void addContentToFootprint(QObject* Object, CDockWidgetFootprint& Footprint)
+{
+	if (!Object)
+	{
+		return;
+	}
+
+	Footprint.ContentObjectCount++;
+	Footprint.ContentWidgetCount += Object->isWidgetType() ? 1 : 0;
+	for (auto Child : Object->children())
+	{
+		addContentToFootprint(Child, Footprint);
+	}
+}
+
+
 //============================================================================
 void DockWidgetPrivate::setupToolBar()
 {
 	ToolBar = new QToolBar(_this);
 	ToolBar->setObjectName("dockWidgetToolBar");
-	Layout->insertWidget(0, ToolBar);
+	contentLayout()->insertWidget(0, ToolBar);
 	ToolBar->setIconSize(QSize(16, 16));
 	ToolBar->toggleViewAction()->setEnabled(false);
 	ToolBar->toggleViewAction()->setVisible(false);
@@ -213,7 +414,7 @@ void DockWidgetPrivate::setupScrollArea()
 	ScrollArea = new QScrollArea(_this);
 	ScrollArea->setObjectName("dockWidgetScrollArea");
 	ScrollArea->setWidgetResizable(true);
-	Layout->addWidget(ScrollArea);
+	contentLayout()->addWidget(ScrollArea);
 }
 
 
@@ -222,25 +423,29 @@ CDockWidget::CDockWidget(const QString &title, QWidget *parent) :
 	QFrame(parent),
 	d(new DockWidgetPrivate(this))
 {
-	d->Layout = new QBoxLayout(QBoxLayout::TopToBottom);
-	d->Layout->setContentsMargins(0, 0, 0, 0);
-	d->Layout->setSpacing(0);
-	setLayout(d->Layout);
 	setWindowTitle(title);
 	setObjectName(title);
 
-	d->TabWidget = componentsFactory()->createDockWidgetTab(this);
-    d->ToggleViewAction = new QAction(title, this);
-	d->ToggleViewAction->setCheckable(true);
-	connect(d->ToggleViewAction, SIGNAL(triggered(bool)), this,
-		SLOT(toggleView(bool)));
-	setToolbarFloatingStyle(false);
+	// In lean mode the layout, the tab and the toggle view action are
+	// created on first use
+	if (!CDockManager::testConfigFlag(CDockManager::LeanDockWidgets))
+	{
+		d->contentLayout();
+		d->tabWidget();
+		d->toggleViewAction();
+	}
 }
 
 //============================================================================
 CDockWidget::~CDockWidget()
 {
     ADS_PRINT("~CDockWidget()");
+	// If the tab is owned by this dock widget, the components factory
+	// may keep it for reuse
+	if (d->TabWidget && d->TabWidget->parent() == this)
+	{
+		componentsFactory()->recycleDockWidgetTab(d->TabWidget);
+	}
 	delete d;
 }
 
@@ -248,10 +453,7 @@ CDockWidget::~CDockWidget()
 //============================================================================
 void CDockWidget::setToggleViewActionChecked(bool Checked)
 {
-	QAction* Action = d->ToggleViewAction;
-	Action->blockSignals(true);
-	Action->setChecked(Checked);
-	Action->blockSignals(false);
+	d->setToggleViewActionChecked(Checked);
 }
 
 
@@ -266,7 +468,7 @@ void CDockWidget::setWidget(QWidget* widget, eInsertMode InsertMode)
 	auto ScrollAreaWidget = qobject_cast<QAbstractScrollArea*>(widget);
 	if (ScrollAreaWidget || ForceNoScrollArea == InsertMode)
 	{
-		d->Layout->addWidget(widget);
+		d->contentLayout()->addWidget(widget);
 		if (ScrollAreaWidget && ScrollAreaWidget->viewport())
 		{
 			ScrollAreaWidget->viewport()->setProperty("dockWidgetContent", true);
@@ -319,6 +521,13 @@ QWidget* CDockWidget::widget() const
 
 //============================================================================
 CDockWidgetTab* CDockWidget::tabWidget() const
+{
+	return d->tabWidget();
+}
+
+
+//============================================================================
+CDockWidgetTab* CDockWidget::existingTabWidget() const
 {
 	return d->TabWidget;
 }
@@ -333,7 +542,10 @@ void CDockWidget::setFeatures(DockWidgetFeatures features)
 	}
 	d->Features = features;
 	emit featuresChanged(d->Features);
-	d->TabWidget->onDockWidgetFeaturesChanged();
+	if (d->TabWidget)
+	{
+		d->TabWidget->onDockWidgetFeaturesChanged();
+	}
 }
 
 
@@ -428,13 +640,19 @@ bool CDockWidget::isClosed() const
 //============================================================================
 QAction* CDockWidget::toggleViewAction() const
 {
-	return d->ToggleViewAction;
+	return d->toggleViewAction();
 }
 
 
 //============================================================================
 void CDockWidget::setToggleViewActionMode(eToggleViewActionMode Mode)
 {
+	d->ToggleViewActionMode = Mode;
+	if (!d->ToggleViewAction)
+	{
+		return;
+	}
+
 	if (ActionModeToggle == Mode)
 	{
 		d->ToggleViewAction->setCheckable(true);
@@ -443,7 +661,7 @@ void CDockWidget::setToggleViewActionMode(eToggleViewActionMode Mode)
 	else
 	{
 		d->ToggleViewAction->setCheckable(false);
-		d->ToggleViewAction->setIcon(d->TabWidget->icon());
+		d->ToggleViewAction->setIcon(icon());
 	}
 }
 
@@ -461,7 +679,7 @@ void CDockWidget::toggleView(bool Open)
 	// If the toggle view action mode is ActionModeShow, then Open is always
 	// true if the sender is the toggle view action
 	QAction* Sender = qobject_cast<QAction*>(sender());
-	if (Sender == d->ToggleViewAction && !d->ToggleViewAction->isCheckable())
+	if (Sender && Sender == d->ToggleViewAction && !Sender->isCheckable())
 	{
 		Open = true;
 	}
@@ -495,9 +713,7 @@ void CDockWidget::toggleViewInternal(bool Open)
 		d->hideDockWidget();
 	}
 	d->Closed = !Open;
-	d->ToggleViewAction->blockSignals(true);
-	d->ToggleViewAction->setChecked(Open);
-	d->ToggleViewAction->blockSignals(false);
+	d->setToggleViewActionChecked(Open);
 	if (d->DockArea)
 	{
 		d->DockArea->toggleDockWidgetView(this, Open);
@@ -529,11 +745,88 @@ void CDockWidget::toggleViewInternal(bool Open)
 }
 
 
+//============================================================================
+void CDockWidget::hideViewInternal()
+{
+	if (d->TabWidget)
+	{
+		d->TabWidget->hide();
+	}
+	d->Closed = true;
+	d->setToggleViewActionChecked(false);
+	// The current dock widget of the area may not change, so the area does
+	// not mark the layout model as outdated
+	auto DockContainer = dockContainer();
+	if (DockContainer)
+	{
+		DockContainer->markLayoutModelDirty();
+	}
+}
+
+
+//============================================================================
+CDockWidgetFootprint CDockWidget::footprint() const
+{
+	CDockWidgetFootprint Footprint;
+	Footprint.PrivateDataBytes = sizeof(DockWidgetPrivate);
+	if (d->ToolBarSettings)
+	{
+		Footprint.PrivateDataBytes += sizeof(DockWidgetToolBarSettings);
+	}
+	if (d->TabWidget)
+	{
+		Footprint.PrivateDataBytes += CDockWidgetTab::privateDataSize();
+	}
+	addToFootprint(d->Layout, nullptr, Footprint);
+	addToFootprint(d->TabWidget, nullptr, Footprint, &Footprint.TabObjectCount);
+	addToFootprint(d->ToggleViewAction, nullptr, Footprint);
+	addToFootprint(d->ScrollArea, d->Widget, Footprint, &Footprint.ScrollAreaObjectCount);
+	addToFootprint(d->ToolBar, nullptr, Footprint, &Footprint.ToolBarObjectCount);
+	addContentToFootprint(d->Widget, Footprint);
+	return Footprint;
+}
+
+
+//============================================================================
+bool CDockWidget::isInResizeBurst() const
+{
+	return d->ResizeBurstCount > 0;
+}
+
+
+//============================================================================
+void CDockWidget::beginResizeBurst()
+{
+	if (1 == ++d->ResizeBurstCount)
+	{
+		emit resizeBurstStarted();
+	}
+}
+
+
+//============================================================================
+void CDockWidget::endResizeBurst()
+{
+	if (d->ResizeBurstCount <= 0)
+	{
+		return;
+	}
+
+	if (0 == --d->ResizeBurstCount)
+	{
+		emit resizeBurstFinished();
+	}
+}
+
+
 //============================================================================
 void CDockWidget::setDockArea(CDockAreaWidget* DockArea)
 {
 	d->DockArea = DockArea;
-	d->ToggleViewAction->setChecked(DockArea != nullptr && !this->isClosed());
+	if (d->ToggleViewAction)
+	{
+		d->ToggleViewAction->setChecked(DockArea != nullptr && !this->isClosed());
+	}
 }
 
 
@@ -554,7 +847,10 @@ void CDockWidget::flagAsUnassigned()
 	setParent(d->DockManager);
 	setVisible(false);
 	setDockArea(nullptr);
-	tabWidget()->setParent(this);
+	if (d->TabWidget)
+	{
+		d->TabWidget->setParent(this);
+	}
 }
 
 
@@ -586,6 +882,10 @@ bool CDockWidget::event(QEvent *e)
 			{
 				d->DockArea->markTitleBarMenuOutdated();//update tabs menu
 			}
+			if (d->DockManager)
+			{
+				d->DockManager->updateSearchIndex(this);
+			}
 			emit titleChanged(title);
 		}
 		break;
@@ -602,10 +902,7 @@ bool CDockWidget::event(QEvent *e)
 //============================================================================
 void CDockWidget::setTabToolTip(const QString &text)
 {
-	if (d->TabWidget)
-	{
-		d->TabWidget->setToolTip(text);
-	}
+	d->tabWidget()->setToolTip(text);
 	if (d->ToggleViewAction)
 	{
 		d->ToggleViewAction->setToolTip(text);
@@ -621,8 +918,8 @@ void CDockWidget::setTabToolTip(const QString &text)
 //============================================================================
 void CDockWidget::setIcon(const QIcon& Icon)
 {
-	d->TabWidget->setIcon(Icon);
-	if (!d->ToggleViewAction->isCheckable())
+	d->tabWidget()->setIcon(Icon);
+	if (d->ToggleViewAction && !d->ToggleViewAction->isCheckable())
 	{
 		d->ToggleViewAction->setIcon(Icon);
 	}
@@ -632,7 +929,7 @@ void CDockWidget::setIcon(const QIcon& Icon)
 //============================================================================
 QIcon CDockWidget::icon() const
 {
-	return d->TabWidget->icon();
+	return d->TabWidget ? d->TabWidget->icon() : QIcon();
 }
 
 
@@ -664,7 +961,7 @@ void CDockWidget::setToolBar(QToolBar* ToolBar)
 	}
 
 	d->ToolBar = ToolBar;
-	d->Layout->insertWidget(0, d->ToolBar);
+	d->contentLayout()->insertWidget(0, d->ToolBar);
 	this->connect(this, SIGNAL(topLevelChanged(bool)), SLOT(setToolbarFloatingStyle(bool)));
 	setToolbarFloatingStyle(isFloating());
 }
@@ -675,11 +972,11 @@ void CDockWidget::setToolBarStyle(Qt::ToolButtonStyle Style, eState State)
 {
 	if (StateFloating == State)
 	{
-		d->ToolBarStyleFloating = Style;
+		d->customToolBarSettings().StyleFloating = Style;
 	}
 	else
 	{
-		d->ToolBarStyleDocked = Style;
+		d->customToolBarSettings().StyleDocked = Style;
 	}
 
 	setToolbarFloatingStyle(isFloating());
@@ -691,11 +988,11 @@ Qt::ToolButtonStyle CDockWidget::toolBarStyle(eState State) const
 {
 	if (StateFloating == State)
 	{
-		return d->ToolBarStyleFloating;
+		return d->toolBarSettings().StyleFloating;
 	}
 	else
 	{
-		return d->ToolBarStyleDocked;
+		return d->toolBarSettings().StyleDocked;
 	}
 }
 
@@ -705,11 +1002,11 @@ void CDockWidget::setToolBarIconSize(const QSize& IconSize, eState State)
 {
 	if (StateFloating == State)
 	{
-		d->ToolBarIconSizeFloating = IconSize;
+		d->customToolBarSettings().IconSizeFloating = IconSize;
 	}
 	else
 	{
-		d->ToolBarIconSizeDocked = IconSize;
+		d->customToolBarSettings().IconSizeDocked = IconSize;
 	}
 
 	setToolbarFloatingStyle(isFloating());
@@ -721,11 +1018,11 @@ QSize CDockWidget::toolBarIconSize(eState State) const
 {
 	if (StateFloating == State)
 	{
-		return d->ToolBarIconSizeFloating;
+		return d->toolBarSettings().IconSizeFloating;
 	}
 	else
 	{
-		return d->ToolBarIconSizeDocked;
+		return d->toolBarSettings().IconSizeDocked;
 	}
 }
 
@@ -738,13 +1035,14 @@ void CDockWidget::setToolbarFloatingStyle(bool Floating)
 		return;
 	}
 
-	auto IconSize = Floating ? d->ToolBarIconSizeFloating : d->ToolBarIconSizeDocked;
+	const auto& Settings = d->toolBarSettings();
+	auto IconSize = Floating ? Settings.IconSizeFloating : Settings.IconSizeDocked;
 	if (IconSize != d->ToolBar->iconSize())
 	{
 		d->ToolBar->setIconSize(IconSize);
 	}
 
-	auto ButtonStyle = Floating ? d->ToolBarStyleFloating : d->ToolBarStyleDocked;
+	auto ButtonStyle = Floating ? Settings.StyleFloating : Settings.StyleDocked;
 	if (ButtonStyle != d->ToolBar->toolButtonStyle())
 	{
 		d->ToolBar->setToolButtonStyle(ButtonStyle);
@@ -766,9 +1064,21 @@ void CDockWidget::emitTopLevelEventForWidget(CDockWidget* TopLevelDockWidget, bo
 //============================================================================
 void CDockWidget::emitTopLevelChanged(bool Floating)
 {
+	// The dock manager emits the top level events for all dock widgets
+	// when the layout change is committed
+	if (d->DockManager && d->DockManager->isLayoutChangeActive())
+	{
+		return;
+	}
+
 	if (Floating != d->IsFloatingTopLevel)
 	{
 		d->IsFloatingTopLevel = Floating;
+		auto Statistics = d->DockManager ? d->DockManager->mutableStatistics() : nullptr;
+		if (Statistics)
+		{
+			Statistics->TopLevelSignalCount++;
+		}
 		emit topLevelChanged(d->IsFloatingTopLevel);
 	}
 }
@@ -802,16 +1112,80 @@ void CDockWidget::setFloating()
 	{
 		return;
 	}
-	d->TabWidget->detachDockWidget();
+	d->tabWidget()->detachDockWidget();
 }
 
 
 //============================================================================
 void CDockWidget::deleteDockWidget()
 {
-	dockManager()->removeDockWidget(this);
-	deleteLater();
+	auto DockManager = dockManager();
+	DockManager->removeDockWidget(this);
 	d->Closed = true;
+	if (DockManager->recycleDockWidget(this))
+	{
+		return;
+	}
+
+	// The tab is not needed by the dock area anymore - we take ownership
+	// to delete or recycle it together with this dock widget
+	if (d->TabWidget)
+	{
+		d->TabWidget->setParent(this);
+	}
+	deleteLater();
+}
+
+
+//============================================================================
+void CDockWidget::prepareForPool()
+{
+	if (d->ToggleViewAction && d->DockManager)
+	{
+		d->DockManager->removeToggleViewActionFromMenus(d->ToggleViewAction);
+	}
+	flagAsUnassigned();
+}
+
+
+//============================================================================
+void CDockWidget::prepareForReuse()
+{
+	QWidget* Content = takeWidget();
+	if (Content)
+	{
+		Content->deleteLater();
+	}
+
+	if (d->ToolBar)
+	{
+		delete d->ToolBar;
+		d->ToolBar = nullptr;
+	}
+
+	// Signals must not reach the receivers of the previous user of this
+	// dock widget
+	disconnect();
+	d->Features = DefaultDockWidgetFeatures;
+	d->TitleBarActions.clear();
+	d->IsFloatingTopLevel = false;
+	d->MinimumSizeHintMode = MinimumSizeHintFromDockWidget;
+	delete d->ToolBarSettings;
+	d->ToolBarSettings = nullptr;
+	d->ToggleViewActionMode = ActionModeToggle;
+	if (d->ToggleViewAction)
+	{
+		d->ToggleViewAction->setCheckable(true);
+		d->ToggleViewAction->setIcon(QIcon());
+	}
+	setProperty(internal::DirtyProperty, QVariant());
+	setProperty(internal::ClosedProperty, QVariant());
+	setToolTip(QString());
+	flagAsUnassigned();
+	if (d->TabWidget)
+	{
+		d->TabWidget->setDockWidget(this);
+	}
 }
 
 
@@ -868,6 +1242,10 @@ bool CDockWidget::closeDockWidgetInternal(bool ForceClose)
 void CDockWidget::setTitleBarActions(QList<QAction*> actions)
 {
 	d->TitleBarActions = actions;
+	if (d->DockArea)
+	{
+		d->DockArea->titleBar()->invalidateDockWidgetActionsButtons(this);
+	}
 }
 
 
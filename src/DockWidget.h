@@ -47,6 +47,42 @@ class CDockAreaWidget;
 class DockContainerWidgetPrivate;
 class CFloatingDockContainer;
 
+/**
+ * Approximate memory footprint of the docking system part of a dock widget.
+ * The object counts only contain objects created by the docking system.
+ * The content widget subtree of the application is reported separately.
+ */
+struct CDockWidgetFootprint
+{
+	int ObjectCount = 0; ///< QObjects created by the docking system
+	int WidgetCount = 0; ///< QWidgets among the counted objects
+	int PrivateDataBytes = 0; ///< heap bytes of the dock widget and tab private data
+	int TabObjectCount = 0; ///< objects of the tab widget subtree
+	int ScrollAreaObjectCount = 0; ///< objects of the scroll area without the content
+	int ToolBarObjectCount = 0; ///< objects of the toolbar subtree
+	int LabelCount = 0; ///< labels among the counted objects
+	int ButtonCount = 0; ///< buttons among the counted objects
+	int ActionCount = 0; ///< actions among the counted objects
+	int ContentObjectCount = 0; ///< QObjects of the application content widget subtree
+	int ContentWidgetCount = 0; ///< QWidgets of the application content widget subtree
+
+	CDockWidgetFootprint& operator+=(const CDockWidgetFootprint& Other)
+	{
+		ObjectCount += Other.ObjectCount;
+		WidgetCount += Other.WidgetCount;
+		PrivateDataBytes += Other.PrivateDataBytes;
+		TabObjectCount += Other.TabObjectCount;
+		ScrollAreaObjectCount += Other.ScrollAreaObjectCount;
+		ToolBarObjectCount += Other.ToolBarObjectCount;
+		LabelCount += Other.LabelCount;
+		ButtonCount += Other.ButtonCount;
+		ActionCount += Other.ActionCount;
+		ContentObjectCount += Other.ContentObjectCount;
+		ContentWidgetCount += Other.ContentWidgetCount;
+		return *this;
+	}
+};
+
 /**
  * The QDockWidget class provides a widget that can be docked inside a
  * CDockManager or floated as a top-level window on the desktop.
@@ -111,6 +147,29 @@ protected:
      */
     void flagAsUnassigned();
 
+    /**
+     * Hides this dock widget and removes its toggle view action from all
+     * menus if the dock manager puts it into the dock widget pool. The
+     * content and the signal connections are kept, so the receivers of
+     * the closed() signal still see the dock widget of their user.
+     */
+    void prepareForPool();
+
+    /**
+     * Resets this dock widget to the state of a newly created dock widget.
+     * The content widget and the tool bar are deleted and all signal
+     * connections are removed. This function is used by the dock manager
+     * if recycling of deleted dock widgets is enabled.
+     */
+    void prepareForReuse();
+
+    /**
+     * Returns the tab widget if it has already been created. In contrast
+     * to tabWidget(), this function never creates the tab of a lean dock
+     * widget and returns a nullptr instead.
+     */
+    CDockWidgetTab* existingTabWidget() const;
+
     /**
      * Call this function to emit a topLevelChanged() signal and to update
      * the dock area tool bar visibility
@@ -136,6 +195,13 @@ protected:
      */
     void toggleViewInternal(bool Open);
 
+    /**
+     * Marks the dock widget as closed and hides its tab without updating
+     * the dock area and without emitting any signals. This is used by the
+     * dock manager to close many dock widgets in one batch.
+     */
+    void hideViewInternal();
+
     /**
      * Internal close dock widget implementation.
      * The function returns true if the dock widget has been closed or hidden
@@ -469,6 +535,40 @@ public:
      */
     bool isCurrentTab() const;
 
+    /**
+     * Returns true, while the dock widget is resized interactively or
+     * by restoreState(). Expensive content widgets can use this to draw
+     * a cheap preview during the resize burst and to do one full render
+     * if the resizeBurstFinished() signal is emitted.
+     */
+    bool isInResizeBurst() const;
+
+    /**
+     * Starts a resize burst. The docking system calls this function if the
+     * user starts dragging a splitter handle, if the user resizes a
+     * floating widget and before the state is restored. The burst of
+     * restoreState() ends after the final relayout in the next event loop
+     * iteration. Resize bursts may be nested. Only the first call emits
+     * resizeBurstStarted().
+     */
+    void beginResizeBurst();
+
+    /**
+     * Ends a resize burst started with beginResizeBurst(). The last call
+     * emits resizeBurstFinished().
+     */
+    void endResizeBurst();
+
+    /**
+     * Returns the approximate memory footprint of the objects that the
+     * docking system created for this dock widget: the layout, the tab,
+     * the toggle view action, the scroll area and the toolbar. The objects
+     * of the content widget are reported separately.
+     * Use this function to compare the footprint of lean dock widgets
+     * (see CDockManager::LeanDockWidgets) with fully constructed ones.
+     */
+    CDockWidgetFootprint footprint() const;
+
 public: // reimplements QFrame -----------------------------------------------
     /**
      * Emits titleChanged signal if title change event occurs
@@ -577,6 +677,18 @@ signals:
      * The features parameter gives the new value of the property.
      */
     void featuresChanged(DockWidgetFeatures features);
+
+    /**
+     * This signal is emitted if a resize burst starts, i.e. if the user
+     * starts dragging a splitter handle
+     */
+    void resizeBurstStarted();
+
+    /**
+     * This signal is emitted if a resize burst has finished. The dock
+     * widget has its final size now.
+     */
+    void resizeBurstFinished();
 }; // class DockWidget
 }
  // namespace ads
@@ -0,0 +1,435 @@
+/*******************************************************************************
+** Qt Advanced Docking System
+** Copyright (C) 2017 Uwe Kindler
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 2.1 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+
+//============================================================================
+/// \file   DockWidgetSearchIndex.cpp
+/// \author Uwe Kindler
+/// \date   19.10.2026
+/// \brief  Implementation of CDockWidgetSearchIndex class
+//============================================================================
+
+
+//============================================================================
+//                                   INCLUDES
+//============================================================================
+#include "DockWidgetSearchIndex.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <QHash>
+#include <QVector>
+
+#include "DockWidget.h"
+
+
+namespace ads
+{
+/**
+ * Subsequence matches always rank above trigram matches
+ */
+static const int SubsequenceMatchBase = 1 << 20;
+
+
+/**
+ * Single index entry. All strings are stored lower cased to avoid case
+ * conversions during queries
+ */
+struct SearchIndexEntry
+{
+	CDockWidget* DockWidget = nullptr;
+	QString Title;
+	QString ObjectName;
+	QString Group;
+	QVector<quint64> Trigrams;
+};
+
+
+/**
+ * Private data class of CDockWidgetSearchIndex class (pimpl)
+ */
+struct DockWidgetSearchIndexPrivate
+{
+	CDockWidgetSearchIndex* _this;
+	QVector<SearchIndexEntry> Entries;
+	QVector<int> FreeSlots;
+	QHash<CDockWidget*, int> Slots;
+	QHash<quint64, QVector<int>> Postings;
+
+	/**
+	 * Private data constructor
+	 */
+	DockWidgetSearchIndexPrivate(CDockWidgetSearchIndex* _public);
+
+	/**
+	 * Fills the entry in the given slot from the current dock widget state
+	 * and updates the trigram postings
+	 */
+	void refreshEntry(int Slot);
+
+	/**
+	 * Adds the trigrams of the entry in the given slot to the postings
+	 */
+	void indexTrigrams(int Slot);
+
+	/**
+	 * Removes the trigrams of the entry in the given slot from the postings
+	 */
+	void unindexTrigrams(int Slot);
+};
+// struct DockWidgetSearchIndexPrivate
+
+
+//============================================================================
+static quint64 trigramKey(QChar a, QChar b, QChar c)
+{
+	return (quint64(a.unicode()) << 32) | (quint64(b.unicode()) << 16) | c.unicode();
+}
+
+
+//============================================================================
+static void appendTrigrams(const QString& Text, QVector<quint64>& Trigrams)
+{
+	for (int i = 0; i + 2 < Text.size(); ++i)
+	{
+		Trigrams.append(trigramKey(Text.at(i), Text.at(i + 1), Text.at(i + 2)));
+	}
+}
+
+
+//============================================================================
+static void makeUnique(QVector<quint64>& Trigrams)
+{
+	std::sort(Trigrams.begin(), Trigrams.end());
+	Trigrams.erase(std::unique(Trigrams.begin(), Trigrams.end()), Trigrams.end());
+}
+
+
+/**
+ * Returns a score >= 0 if Pattern is a subsequence of Text and -1 if not.
+ * Consecutive characters and characters at word starts score higher and
+ * shorter texts are preferred.
+ */
+static int subsequenceScore(const QString& Pattern, const QString& Text)
+{
+	const int PatternLength = Pattern.size();
+	int Score = 0;
+	int p = 0;
+	int LastMatch = -2;
+	for (int i = 0; i < Text.size() && p < PatternLength; ++i)
+	{
+		if (Text.at(i) != Pattern.at(p))
+		{
+			continue;
+		}
+
+		int CharScore = 1;
+		if (i == LastMatch + 1)
+		{
+			CharScore += 4;
+		}
+		if (i == 0 || !Text.at(i - 1).isLetterOrNumber())
+		{
+			CharScore += 6;
+		}
+		Score += CharScore;
+		LastMatch = i;
+		++p;
+	}
+
+	if (p < PatternLength)
+	{
+		return -1;
+	}
+
+	return qMax(0, Score * 8 - (Text.size() - PatternLength));
+}
+
+
+//============================================================================
+DockWidgetSearchIndexPrivate::DockWidgetSearchIndexPrivate(CDockWidgetSearchIndex* _public) :
+	_this(_public)
+{
+
+}
+
+
+//============================================================================
+void DockWidgetSearchIndexPrivate::refreshEntry(int Slot)
+{
+	unindexTrigrams(Slot);
+	auto& Entry = Entries[Slot];
+	Entry.Title = Entry.DockWidget->windowTitle().toLower();
+	Entry.ObjectName = Entry.DockWidget->objectName().toLower();
+	Entry.Trigrams.clear();
+	appendTrigrams(Entry.Title, Entry.Trigrams);
+	appendTrigrams(Entry.ObjectName, Entry.Trigrams);
+	appendTrigrams(Entry.Group, Entry.Trigrams);
+	makeUnique(Entry.Trigrams);
+	indexTrigrams(Slot);
+}
+
+
+//============================================================================
+void DockWidgetSearchIndexPrivate::indexTrigrams(int Slot)
+{
+	for (auto Trigram : Entries[Slot].Trigrams)
+	{
+		Postings[Trigram].append(Slot);
+	}
+}
+
+
+//============================================================================
+void DockWidgetSearchIndexPrivate::unindexTrigrams(int Slot)
+{
+	for (auto Trigram : Entries[Slot].Trigrams)
+	{
+		auto it = Postings.find(Trigram);
+		if (it == Postings.end())
+		{
+			continue;
+		}
+
+		it->removeOne(Slot);
+		if (it->isEmpty())
+		{
+			Postings.erase(it);
+		}
+	}
+}
+
+
+//============================================================================
+CDockWidgetSearchIndex::CDockWidgetSearchIndex() :
+	d(new DockWidgetSearchIndexPrivate(this))
+{
+
+}
+
+
+//============================================================================
+CDockWidgetSearchIndex::~CDockWidgetSearchIndex()
+{
+	delete d;
+}
+
+
+//============================================================================
+void CDockWidgetSearchIndex::insert(CDockWidget* DockWidget)
+{
+	if (!DockWidget)
+	{
+		return;
+	}
+
+	int Slot = d->Slots.value(DockWidget, -1);
+	if (Slot < 0)
+	{
+		if (d->FreeSlots.isEmpty())
+		{
+			Slot = d->Entries.size();
+			d->Entries.append(SearchIndexEntry());
+		}
+		else
+		{
+			Slot = d->FreeSlots.takeLast();
+		}
+		d->Entries[Slot].DockWidget = DockWidget;
+		d->Slots.insert(DockWidget, Slot);
+	}
+
+	d->refreshEntry(Slot);
+}
+
+
+//============================================================================
+void CDockWidgetSearchIndex::remove(CDockWidget* DockWidget)
+{
+	int Slot = d->Slots.value(DockWidget, -1);
+	if (Slot < 0)
+	{
+		return;
+	}
+
+	d->unindexTrigrams(Slot);
+	d->Entries[Slot] = SearchIndexEntry();
+	d->Slots.remove(DockWidget);
+	d->FreeSlots.append(Slot);
+}
+
+
+//============================================================================
+void CDockWidgetSearchIndex::update(CDockWidget* DockWidget)
+{
+	int Slot = d->Slots.value(DockWidget, -1);
+	if (Slot >= 0)
+	{
+		d->refreshEntry(Slot);
+	}
+}
+
+
+//============================================================================
+void CDockWidgetSearchIndex::setGroup(CDockWidget* DockWidget, const QString& Group)
+{
+	int Slot = d->Slots.value(DockWidget, -1);
+	if (Slot < 0)
+	{
+		return;
+	}
+
+	d->Entries[Slot].Group = Group.toLower();
+	d->refreshEntry(Slot);
+}
+
+
+//============================================================================
+bool CDockWidgetSearchIndex::contains(CDockWidget* DockWidget) const
+{
+	return d->Slots.contains(DockWidget);
+}
+
+
+//============================================================================
+int CDockWidgetSearchIndex::count() const
+{
+	return d->Slots.count();
+}
+
+
+//============================================================================
+void CDockWidgetSearchIndex::clear()
+{
+	d->Entries.clear();
+	d->FreeSlots.clear();
+	d->Slots.clear();
+	d->Postings.clear();
+}
+
+
+//============================================================================
+QList<CDockWidget*> CDockWidgetSearchIndex::query(const QString& Text, int MaxCount) const
+{
+	struct Match
+	{
+		int Score;
+		int Slot;
+	};
+
+	const QString Pattern = Text.trimmed().toLower();
+	const auto& Entries = d->Entries;
+	std::vector<Match> Matches;
+	Matches.reserve(d->Slots.count());
+	std::vector<int> Scores(Entries.size(), -1);
+
+	for (int Slot = 0; Slot < Entries.size(); ++Slot)
+	{
+		const auto& Entry = Entries[Slot];
+		if (!Entry.DockWidget)
+		{
+			continue;
+		}
+
+		if (Pattern.isEmpty())
+		{
+			Matches.push_back({0, Slot});
+			continue;
+		}
+
+		// The title is what the user sees, so it is weighted highest
+		int Score = subsequenceScore(Pattern, Entry.Title);
+		Score = (Score < 0) ? -1 : Score * 3;
+		int ObjectNameScore = subsequenceScore(Pattern, Entry.ObjectName);
+		Score = qMax(Score, (ObjectNameScore < 0) ? -1 : ObjectNameScore * 2);
+		Score = qMax(Score, subsequenceScore(Pattern, Entry.Group));
+		if (Score >= 0)
+		{
+			Scores[Slot] = Score;
+			Matches.push_back({SubsequenceMatchBase + Score, Slot});
+		}
+	}
+
+	// Typo tolerant fallback for entries that do not contain the pattern
+	// as subsequence
+	if (Pattern.size() >= 3)
+	{
+		QVector<quint64> PatternTrigrams;
+		appendTrigrams(Pattern, PatternTrigrams);
+		makeUnique(PatternTrigrams);
+		std::vector<int> SharedTrigrams(Entries.size(), 0);
+		for (auto Trigram : PatternTrigrams)
+		{
+			auto it = d->Postings.constFind(Trigram);
+			if (it == d->Postings.constEnd())
+			{
+				continue;
+			}
+
+			for (auto Slot : *it)
+			{
+				SharedTrigrams[Slot]++;
+			}
+		}
+
+		const int TrigramCount = PatternTrigrams.size();
+		for (int Slot = 0; Slot < Entries.size(); ++Slot)
+		{
+			if (Scores[Slot] >= 0 || (SharedTrigrams[Slot] * 2 < TrigramCount))
+			{
+				continue;
+			}
+
+			Matches.push_back({SharedTrigrams[Slot] * 100 / TrigramCount, Slot});
+		}
+	}
+
+	auto IsBetter = [&Entries](const Match& a, const Match& b)
+		{
+			if (a.Score != b.Score)
+			{
+				return a.Score > b.Score;
+			}
+			return Entries[a.Slot].Title < Entries[b.Slot].Title;
+		};
+
+	if (MaxCount >= 0 && MaxCount < int(Matches.size()))
+	{
+		std::partial_sort(Matches.begin(), Matches.begin() + MaxCount,
+			Matches.end(), IsBetter);
+		Matches.resize(MaxCount);
+	}
+	else
+	{
+		std::sort(Matches.begin(), Matches.end(), IsBetter);
+	}
+
+	QList<CDockWidget*> Result;
+	Result.reserve(int(Matches.size()));
+	for (const auto& Candidate : Matches)
+	{
+		Result.append(Entries[Candidate.Slot].DockWidget);
+	}
+	return Result;
+}
+
+} // namespace ads
+
+//---------------------------------------------------------------------------
+// EOF DockWidgetSearchIndex.cpp
@@ -0,0 +1,118 @@
+#ifndef DockWidgetSearchIndexH
+#define DockWidgetSearchIndexH
+/*******************************************************************************
+** Qt Advanced Docking System
+** Copyright (C) 2017 Uwe Kindler
+**
+** This library is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Lesser General Public
+** License as published by the Free Software Foundation; either
+** version 2.1 of the License, or (at your option) any later version.
+**
+** This library is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Lesser General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public
+** License along with this library; If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+
+//============================================================================
+/// \file   DockWidgetSearchIndex.h
+/// \author Uwe Kindler
+/// \date   19.10.2026
+/// \brief  Declaration of CDockWidgetSearchIndex class
+//============================================================================
+
+
+//============================================================================
+//                                   INCLUDES
+//============================================================================
+#include "ads_globals.h"
+
+#include <QList>
+#include <QString>
+
+namespace ads
+{
+class CDockWidget;
+struct DockWidgetSearchIndexPrivate;
+
+/**
+ * Incremental fuzzy search index over the dock widgets of a dock manager.
+ * Each entry stores the lower cased title, object name and view menu group
+ * of a dock widget. The index is updated incrementally by the dock manager
+ * if dock widgets are added, removed or renamed, so queries never need to
+ * walk the widget hierarchy.
+ * Queries are ranked by subsequence matching (consecutive characters and
+ * word starts score higher). If a pattern is not a subsequence of any
+ * field, a trigram overlap score is used as typo tolerant fallback.
+ */
+class ADS_EXPORT CDockWidgetSearchIndex
+{
+private:
+	DockWidgetSearchIndexPrivate* d; ///< private data (pimpl)
+	friend struct DockWidgetSearchIndexPrivate;
+
+public:
+	/**
+	 * Default Constructor
+	 */
+	CDockWidgetSearchIndex();
+
+	/**
+	 * Virtual Destructor
+	 */
+	virtual ~CDockWidgetSearchIndex();
+
+	/**
+	 * Adds the given dock widget to the index or refreshes its entry if
+	 * it is already indexed
+	 */
+	void insert(CDockWidget* DockWidget);
+
+	/**
+	 * Removes the given dock widget from the index
+	 */
+	void remove(CDockWidget* DockWidget);
+
+	/**
+	 * Refreshes the title and object name of an indexed dock widget.
+	 * Does nothing if the dock widget is not indexed.
+	 */
+	void update(CDockWidget* DockWidget);
+
+	/**
+	 * Assigns the view menu group name to an indexed dock widget
+	 */
+	void setGroup(CDockWidget* DockWidget, const QString& Group);
+
+	/**
+	 * Returns true, if the given dock widget is indexed
+	 */
+	bool contains(CDockWidget* DockWidget) const;
+
+	/**
+	 * Returns the number of indexed dock widgets
+	 */
+	int count() const;
+
+	/**
+	 * Removes all entries
+	 */
+	void clear();
+
+	/**
+	 * Returns the best matching dock widgets for the given search text
+	 * sorted by descending score. An empty search text returns all dock
+	 * widgets sorted by title. If MaxCount is negative, all matches are
+	 * returned.
+	 */
+	QList<CDockWidget*> query(const QString& Text, int MaxCount = -1) const;
+}; // class DockWidgetSearchIndex
+} // namespace ads
+
+//---------------------------------------------------------------------------
+#endif // DockWidgetSearchIndexH
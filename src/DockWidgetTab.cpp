@@ -219,6 +219,7 @@ void DockWidgetTabPrivate::moveTab(QMouseEvent* ev)
     TargetPos.rx() = qMin(_this->parentWidget()->rect().right() - _this->width() + 1, TargetPos.rx());
     _this->move(TargetPos);
     _this->raise();
+    emit _this->moving(ev->globalPos());
 }
 
 
@@ -294,6 +295,13 @@ CDockWidgetTab::~CDockWidgetTab()
 }
 
 
+//============================================================================
+int CDockWidgetTab::privateDataSize()
+{
+	return sizeof(DockWidgetTabPrivate);
+}
+
+
 //============================================================================
 void CDockWidgetTab::mousePressEvent(QMouseEvent* ev)
 {
@@ -485,6 +493,23 @@ CDockWidget* CDockWidgetTab::dockWidget() const
 }
 
 
+//============================================================================
+void CDockWidgetTab::setDockWidget(CDockWidget* DockWidget)
+{
+	d->DockWidget = DockWidget;
+	d->DockArea = nullptr;
+	d->DragState = DraggingInactive;
+	d->FloatingWidget = nullptr;
+	d->GlobalDragStartMousePosition = QPoint();
+	d->DragStartMousePosition = QPoint();
+	setIcon(QIcon());
+	setToolTip(QString());
+	setText(DockWidget->windowTitle());
+	setActiveTab(false);
+	onDockWidgetFeaturesChanged();
+}
+
+
 //============================================================================
 void CDockWidgetTab::setDockAreaWidget(CDockAreaWidget* DockArea)
 {
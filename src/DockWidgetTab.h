@@ -56,6 +56,12 @@ private:
 	friend class CDockWidget;
 	void onDockWidgetFeaturesChanged();
 
+	/**
+	 * Returns the size of the private data for the footprint of the dock
+	 * widget
+	 */
+	static int privateDataSize();
+
 private slots:
 	void detachDockWidget();
 
@@ -112,6 +118,13 @@ public:
 	 */
 	CDockWidget* dockWidget() const;
 
+	/**
+	 * Assigns a new dock widget to this tab and resets the tab state.
+	 * This function is used by the components factory to reuse the tab of
+	 * a deleted dock widget for a new dock widget.
+	 */
+	void setDockWidget(CDockWidget* DockWidget);
+
 	/**
 	 * Sets the icon to show in title bar
 	 */
@@ -161,6 +174,7 @@ signals:
 	void clicked();
 	void closeRequested();
 	void closeOtherTabsRequested();
+	void moving(const QPoint& GlobalPos);
 	void moved(const QPoint& GlobalPos);
 	void elidedChanged(bool elided);
 }; // class DockWidgetTab
@@ -39,12 +39,14 @@
 #include <QAbstractButton>
 #include <QElapsedTimer>
 #include <QTime>
+#include <QTimer>
 
 #include "DockContainerWidget.h"
 #include "DockAreaWidget.h"
 #include "DockManager.h"
 #include "DockWidget.h"
 #include "DockOverlay.h"
+#include "DockTrace.h"
 
 #ifdef Q_OS_WIN
 #include <windows.h>
@@ -368,6 +370,10 @@ struct FloatingDockContainerPrivate
 	CDockAreaWidget *SingleDockArea = nullptr;
 	QPoint DragStartPos;
 	bool Hiding = false;
+	QTimer* ResizeBurstTimer = nullptr;
+	QElapsedTimer LastResizeTimer;
+	bool InSizeMoveLoop = false;
+	internal::CResizeBurst ResizeBurst;
 #ifdef Q_OS_LINUX
     QWidget* MouseEventHandler = nullptr;
     CFloatingWidgetTitleBar* TitleBar = nullptr;
@@ -506,6 +512,10 @@ void FloatingDockContainerPrivate::updateDropOverlays(const QPoint &GlobalPos)
 		return;
 	}
 
+	ADS_TRACE_SCOPE("FloatingDockContainer::updateDropOverlays");
+	auto Statistics = DockManager->mutableStatistics();
+	internal::CScopedTiming Timing(Statistics ? &Statistics->OverlayUpdate : nullptr);
+
 	auto Containers = DockManager->dockContainers();
 	CDockContainerWidget *TopContainer = nullptr;
 	for (auto ContainerWidget : Containers)
@@ -598,6 +608,16 @@ CFloatingDockContainer::CFloatingDockContainer(CDockManager *DockManager) :
 	connect(d->DockContainer, SIGNAL(dockAreasRemoved()), this,
 	    SLOT(onDockAreasAddedOrRemoved()));
 
+	// Interactive resizing of the window is a sequence of resize events.
+	// The resize burst ends if no resize event arrives within the timeout
+	d->ResizeBurstTimer = new QTimer(this);
+	d->ResizeBurstTimer->setSingleShot(true);
+	d->ResizeBurstTimer->setInterval(200);
+	connect(d->ResizeBurstTimer, &QTimer::timeout, [this]()
+	{
+		d->ResizeBurst.end();
+	});
+
 #ifdef Q_OS_LINUX
     d->TitleBar = new CFloatingWidgetTitleBar(this);
     setWindowFlags(windowFlags() | Qt::Tool);
@@ -710,6 +730,7 @@ bool CFloatingDockContainer::nativeEvent(const QByteArray &eventType, void *mess
 			 break;
 
 		case WM_ENTERSIZEMOVE:
+			 d->InSizeMoveLoop = true;
 			 if (d->isState(DraggingMousePressed))
 			 {
 				ADS_PRINT("CFloatingDockContainer::nativeEvent WM_ENTERSIZEMOVE" << e->type());
@@ -720,6 +741,13 @@ bool CFloatingDockContainer::nativeEvent(const QByteArray &eventType, void *mess
 			 break;
 
 		case WM_EXITSIZEMOVE:
+			 // On Windows we know exactly when the user stops resizing
+			 d->InSizeMoveLoop = false;
+			 if (d->ResizeBurst.isActive())
+			 {
+				 d->ResizeBurstTimer->stop();
+				 d->ResizeBurst.end();
+			 }
 			 if (d->isState(DraggingFloatingWidget))
 			 {
 				 ADS_PRINT("CFloatingDockContainer::nativeEvent WM_EXITSIZEMOVE" << e->type());;
@@ -796,6 +824,36 @@ void CFloatingDockContainer::showEvent(QShowEvent *event)
 }
 
 
+//============================================================================
+void CFloatingDockContainer::resizeEvent(QResizeEvent *event)
+{
+	Super::resizeEvent(event);
+	if (!isVisible() || d->isState(DraggingFloatingWidget))
+	{
+		return;
+	}
+
+	// A single programmatic resize is not a burst. A burst starts if the
+	// user resizes the window - i.e. inside the native size / move loop on
+	// Windows or while the left mouse button is pressed - or if a second
+	// resize follows within the burst interval
+	bool SecondResize = d->LastResizeTimer.isValid()
+		&& d->LastResizeTimer.elapsed() < d->ResizeBurstTimer->interval();
+	d->LastResizeTimer.start();
+	if (!d->ResizeBurst.isActive())
+	{
+		bool UserResize = d->InSizeMoveLoop
+			|| QApplication::mouseButtons().testFlag(Qt::LeftButton);
+		if (!UserResize && !SecondResize)
+		{
+			return;
+		}
+		d->ResizeBurst.begin(dockWidgets());
+	}
+	d->ResizeBurstTimer->start();
+}
+
+
 //============================================================================
 bool CFloatingDockContainer::eventFilter(QObject *watched, QEvent *e)
 {
@@ -180,6 +180,7 @@ protected: // reimplements QWidget
 	virtual void closeEvent(QCloseEvent *event) override;
 	virtual void hideEvent(QHideEvent *event) override;
 	virtual void showEvent(QShowEvent *event) override;
+	virtual void resizeEvent(QResizeEvent *event) override;
 	virtual bool eventFilter(QObject *watched, QEvent *event) override;
 
 #ifdef Q_OS_WIN
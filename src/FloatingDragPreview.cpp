@@ -21,6 +21,7 @@
 #include "DockManager.h"
 #include "DockContainerWidget.h"
 #include "DockOverlay.h"
+#include "DockTrace.h"
 
 namespace ads
 {
@@ -83,6 +84,10 @@ void FloatingDragPreviewPrivate::updateDropOverlays(const QPoint &GlobalPos)
 		return;
 	}
 
+	ADS_TRACE_SCOPE("FloatingDragPreview::updateDropOverlays");
+	auto Statistics = DockManager->mutableStatistics();
+	internal::CScopedTiming Timing(Statistics ? &Statistics->OverlayUpdate : nullptr);
+
 	auto Containers = DockManager->dockContainers();
 	CDockContainerWidget *TopContainer = nullptr;
 	for (auto ContainerWidget : Containers)
@@ -319,6 +324,7 @@ void CFloatingDragPreview::startFloating(const QPoint &DragStartMousePos,
 void CFloatingDragPreview::finishDragging()
 {
 	ADS_PRINT("CFloatingDragPreview::finishDragging");
+	ADS_TRACE_SCOPE("FloatingDragPreview::finishDragging");
 	auto DockDropArea = d->DockManager->dockAreaOverlay()->visibleDropAreaUnderCursor();
 	auto ContainerDropArea = d->DockManager->containerOverlay()->visibleDropAreaUnderCursor();
 	if (!d->DropContainer)
@@ -28,11 +28,16 @@
 //============================================================================
 //                                   INCLUDES
 //============================================================================
+#include <iterator>
+#include <set>
+#include <utility>
+
 #include <QVariant>
 #include <QPainter>
 #include <QAbstractButton>
 
 #include "DockSplitter.h"
+#include "DockWidget.h"
 #include "DockManager.h"
 #include "IconProvider.h"
 #include "ads_globals.h"
@@ -94,6 +99,89 @@ void hideEmptyParentSplitters(CDockSplitter* Splitter)
 }
 
 
+//============================================================================
+void hideEmptyParentSplitters(const QList<CDockSplitter*>& FirstParentSplitters)
+{
+	// The pending splitters are ordered by depth so that the deepest
+	// splitter is processed first
+	std::set<std::pair<int, CDockSplitter*>> Pending;
+	for (auto Splitter : FirstParentSplitters)
+	{
+		if (!Splitter)
+		{
+			continue;
+		}
+
+		int Depth = 0;
+		for (auto Parent = findParent<CDockSplitter*>(Splitter); Parent;
+			Parent = findParent<CDockSplitter*>(Parent))
+		{
+			++Depth;
+		}
+		Pending.insert({Depth, Splitter});
+	}
+
+	while (!Pending.empty())
+	{
+		auto it = std::prev(Pending.end());
+		int Depth = it->first;
+		CDockSplitter* Splitter = it->second;
+		Pending.erase(it);
+		if (!Splitter->isVisible() || Splitter->hasVisibleContent())
+		{
+			continue;
+		}
+
+		Splitter->hide();
+		auto ParentSplitter = findParent<CDockSplitter*>(Splitter);
+		if (ParentSplitter)
+		{
+			Pending.insert({Depth - 1, ParentSplitter});
+		}
+	}
+}
+
+
+//============================================================================
+void CResizeBurst::begin(const QList<CDockWidget*>& DockWidgets)
+{
+	if (Active)
+	{
+		return;
+	}
+
+	Active = true;
+	for (auto DockWidget : DockWidgets)
+	{
+		this->DockWidgets.append(DockWidget);
+		DockWidget->beginResizeBurst();
+	}
+}
+
+
+//============================================================================
+void CResizeBurst::end()
+{
+	if (!Active)
+	{
+		return;
+	}
+
+	// Clear the list before the signals are emitted to make this function
+	// reentrant
+	auto DockWidgets = this->DockWidgets;
+	this->DockWidgets.clear();
+	Active = false;
+	for (auto DockWidget : DockWidgets)
+	{
+		if (DockWidget)
+		{
+			DockWidget->endResizeBurst();
+		}
+	}
+}
+
+
 //============================================================================
 void setButtonIcon(QAbstractButton* Button, QStyle::StandardPixmap StandarPixmap,
 	ads::eIcon CustomIconId)
@@ -31,6 +31,7 @@
 //                                   INCLUDES
 //============================================================================
 #include <QPair>
+#include <QPointer>
 #include <QtCore/QtGlobal>
 #include <QPixmap>
 #include <QWidget>
@@ -72,6 +73,7 @@ enum eStateFileVersion
 };
 
 class CDockSplitter;
+class CDockWidget;
 
 enum DockWidgetArea
 {
@@ -147,6 +149,55 @@ void replaceSplitterWidget(QSplitter* Splitter, QWidget* From, QWidget* To);
  */
 void hideEmptyParentSplitters(CDockSplitter* FirstParentSplitter);
 
+/**
+ * Hides all splitters without visible content in the splitter trees above
+ * the given splitters in one bottom up pass. Each splitter is checked only
+ * once, after all of its child splitters have been checked. Use this
+ * function instead of multiple hideEmptyParentSplitters() calls if many
+ * dock areas have been hidden at once.
+ */
+void hideEmptyParentSplitters(const QList<CDockSplitter*>& FirstParentSplitters);
+
+/**
+ * Helper for the resize burst sources (splitter handles, floating widgets,
+ * restoreState). It starts a resize burst for a list of dock widgets and
+ * ends it later for exactly the same dock widgets, even if some of them
+ * have been moved or deleted in between. An active burst is ended when
+ * the helper is destroyed.
+ */
+class CResizeBurst
+{
+	Q_DISABLE_COPY(CResizeBurst)
+private:
+	QList<QPointer<CDockWidget>> DockWidgets;
+	bool Active = false;
+
+public:
+	CResizeBurst() = default;
+
+	/**
+	 * Ends the burst if it is still active
+	 */
+	~CResizeBurst() {end();}
+
+	/**
+	 * Calls CDockWidget::beginResizeBurst() for all given dock widgets.
+	 * Does nothing if the burst is already active.
+	 */
+	void begin(const QList<CDockWidget*>& DockWidgets);
+
+	/**
+	 * Calls CDockWidget::endResizeBurst() for all dock widgets passed to
+	 * begin()
+	 */
+	void end();
+
+	/**
+	 * Returns true between begin() and end()
+	 */
+	bool isActive() const {return Active;}
+};
+
 /**
  * Convenience class for QPair to provide better naming than first and
  * second
@@ -45,7 +45,14 @@ HEADERS += \
     DockAreaTitleBar.h \
     ElidingLabel.h \
     IconProvider.h \
-    DockComponentsFactory.h 
+    DockComponentsFactory.h \
+    DockWidgetSearchIndex.h \
+    DockQuickSwitcher.h \
+    DockStatistics.h \
+    DockTrace.h \
+    DockLayoutModel.h \
+    DockLayoutSnapshot.h \
+    DockFrameTimeObserver.h
 
 
 SOURCES += \
@@ -64,7 +71,12 @@ SOURCES += \
     DockAreaTitleBar.cpp \
     ElidingLabel.cpp \
     IconProvider.cpp \
-    DockComponentsFactory.cpp
+    DockComponentsFactory.cpp \
+    DockWidgetSearchIndex.cpp \
+    DockQuickSwitcher.cpp \
+    DockTrace.cpp \
+    DockLayoutModel.cpp \
+    DockFrameTimeObserver.cpp
 
 
 unix {
@@ -0,0 +1,712 @@
+//============================================================================
+/// \file   StateTool.cpp
+/// \author Uwe Kindler
+/// \date   19.10.2026
+/// \brief  Command line tool to inspect, validate, convert and time
+///         saved docking states
+//============================================================================
+
+
+//============================================================================
+//                                   INCLUDES
+//============================================================================
+#include <iostream>
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QLabel>
+#include <QMainWindow>
+#include <QSettings>
+#include <QTextStream>
+
+#include "DockManager.h"
+#include "DockWidget.h"
+#include "DockingStateReader.h"
+
+using namespace ads;
+
+/**
+ * Encodings of a saved state
+ */
+enum eStateEncoding
+{
+	EncodingXml,
+	EncodingCompressed,
+	EncodingBase64,
+	EncodingHex,
+	EncodingUnknown
+};
+
+
+/**
+ * A single layout read from the input file
+ */
+struct CLayout
+{
+	QString Name;
+	QByteArray Xml;
+	eStateEncoding Encoding = EncodingUnknown;
+	int EncodedSize = 0;
+};
+
+
+/**
+ * Structure statistics of a layout
+ */
+struct CLayoutStatistics
+{
+	int FileVersion = 0;
+	int ContainerCount = 0;
+	int FloatingContainerCount = 0;
+	int SplitterCount = 0;
+	int MaxSplitterDepth = 0;
+	int AreaCount = 0;
+	int DockWidgetCount = 0;
+	int ClosedDockWidgetCount = 0;
+	int MaxTabCount = 0;
+	int MinSplitterSize = -1;
+	int MaxSplitterSize = 0;
+	QStringList DockWidgetNames;
+	QString Error;
+};
+
+
+//============================================================================
+static const char* encodingName(eStateEncoding Encoding)
+{
+	switch (Encoding)
+	{
+	case EncodingXml: return "xml";
+	case EncodingCompressed: return "compressed";
+	case EncodingBase64: return "base64";
+	case EncodingHex: return "hex";
+	default: return "unknown";
+	}
+}
+
+
+//============================================================================
+static eStateEncoding encodingFromName(const QString& Name)
+{
+	for (int i = EncodingXml; i < EncodingUnknown; ++i)
+	{
+		if (Name == encodingName(eStateEncoding(i)))
+		{
+			return eStateEncoding(i);
+		}
+	}
+	return EncodingUnknown;
+}
+
+
+/**
+ * Decodes a state blob into the XML state. The base64 and hex encodings
+ * may contain compressed or plain XML
+ */
+static QByteArray decodeState(QByteArray Data, eStateEncoding& Encoding)
+{
+	// The compressed data is tried before trimming, because the Adler-32
+	// checksum at the end of the zlib stream may end with whitespace bytes
+	QByteArray Xml = qUncompress(Data);
+	if (Xml.startsWith("<?xml"))
+	{
+		Encoding = EncodingCompressed;
+		return Xml;
+	}
+
+	// Only the text encodings may be surrounded by whitespace
+	Data = Data.trimmed();
+	if (Data.startsWith("@ByteArray(") && Data.endsWith(')'))
+	{
+		Data = Data.mid(11, Data.size() - 12);
+		Xml = qUncompress(Data);
+		if (Xml.startsWith("<?xml"))
+		{
+			Encoding = EncodingCompressed;
+			return Xml;
+		}
+	}
+
+	if (Data.startsWith("<?xml"))
+	{
+		Encoding = EncodingXml;
+		return Data;
+	}
+
+	const QByteArray Decoded[] = {QByteArray::fromBase64(Data), QByteArray::fromHex(Data)};
+	const eStateEncoding Encodings[] = {EncodingBase64, EncodingHex};
+	for (int i = 0; i < 2; ++i)
+	{
+		if (Decoded[i].startsWith("<?xml"))
+		{
+			Encoding = Encodings[i];
+			return Decoded[i];
+		}
+
+		Xml = qUncompress(Decoded[i]);
+		if (Xml.startsWith("<?xml"))
+		{
+			Encoding = Encodings[i];
+			return Xml;
+		}
+	}
+
+	Encoding = EncodingUnknown;
+	return QByteArray();
+}
+
+
+/**
+ * Encodes the XML state. The base64 and hex encodings contain the
+ * compressed state
+ */
+static QByteArray encodeState(const QByteArray& Xml, eStateEncoding Encoding)
+{
+	switch (Encoding)
+	{
+	case EncodingXml: return Xml;
+	case EncodingCompressed: return qCompress(Xml, 9);
+	case EncodingBase64: return qCompress(Xml, 9).toBase64();
+	case EncodingHex: return qCompress(Xml, 9).toHex();
+	default: return QByteArray();
+	}
+}
+
+
+/**
+ * Parses the layouts from the given file. A file with the extension ini
+ * is read as QSettings file. It contains either the perspectives written
+ * by CDockManager::savePerspectives() or, if Key is given, a single state.
+ * Any other file contains one single state.
+ */
+static QList<CLayout> readLayouts(const QString& FileName, const QString& Key,
+	const QString& Perspective, QString& Error)
+{
+	QList<QPair<QString, QByteArray>> Blobs;
+	if (QFileInfo(FileName).suffix().toLower() == "ini")
+	{
+		QSettings Settings(FileName, QSettings::IniFormat);
+		if (!Key.isEmpty())
+		{
+			Blobs.append(qMakePair(Key, Settings.value(Key).toByteArray()));
+		}
+		else
+		{
+			int Size = Settings.beginReadArray("Perspectives");
+			for (int i = 0; i < Size; ++i)
+			{
+				Settings.setArrayIndex(i);
+				QString Name = Settings.value("Name").toString();
+				if (Perspective.isEmpty() || Name == Perspective)
+				{
+					Blobs.append(qMakePair(Name, Settings.value("State").toByteArray()));
+				}
+			}
+			Settings.endArray();
+		}
+	}
+	else
+	{
+		QFile File(FileName);
+		if (!File.open(QIODevice::ReadOnly))
+		{
+			Error = QString("Can not open %1").arg(FileName);
+			return QList<CLayout>();
+		}
+		Blobs.append(qMakePair(QFileInfo(FileName).fileName(), File.readAll()));
+	}
+
+	QList<CLayout> Layouts;
+	for (const auto& Blob : Blobs)
+	{
+		CLayout Layout;
+		Layout.Name = Blob.first;
+		Layout.EncodedSize = Blob.second.size();
+		Layout.Xml = decodeState(Blob.second, Layout.Encoding);
+		Layouts.append(Layout);
+	}
+
+	if (Layouts.isEmpty())
+	{
+		Error = QString("No layout found in %1").arg(FileName);
+	}
+	return Layouts;
+}
+
+
+/**
+ * Parses the state with the CDockingStateReader in the same way the
+ * dock manager does and collects the structure statistics
+ */
+class CStateParser
+{
+private:
+	CDockingStateReader Reader;
+	CLayoutStatistics& Statistics;
+
+	bool fail(const QString& Message)
+	{
+		if (Statistics.Error.isEmpty())
+		{
+			Statistics.Error = QString("line %1: %2").arg(Reader.lineNumber()).arg(Message);
+		}
+		return false;
+	}
+
+	bool parseArea()
+	{
+		Statistics.AreaCount++;
+		bool Ok;
+		Reader.attributes().value("Tabs").toInt(&Ok);
+		if (!Ok)
+		{
+			return fail("Area without valid Tabs attribute");
+		}
+
+		int TabCount = 0;
+		while (Reader.readNextStartElement())
+		{
+			if (Reader.name() != "Widget")
+			{
+				Reader.skipCurrentElement();
+				continue;
+			}
+
+			QString Name = Reader.attributes().value("Name").toString();
+			if (Name.isEmpty())
+			{
+				return fail("Widget without Name attribute");
+			}
+			TabCount++;
+			Statistics.DockWidgetCount++;
+			Statistics.DockWidgetNames.append(Name);
+			if (Reader.attributes().value("Closed").toInt())
+			{
+				Statistics.ClosedDockWidgetCount++;
+			}
+			Reader.skipCurrentElement();
+		}
+		Statistics.MaxTabCount = qMax(Statistics.MaxTabCount, TabCount);
+		return true;
+	}
+
+	bool parseSplitter(int Depth)
+	{
+		Statistics.SplitterCount++;
+		Statistics.MaxSplitterDepth = qMax(Statistics.MaxSplitterDepth, Depth);
+		QString Orientation = Reader.attributes().value("Orientation").toString();
+		if (!Orientation.startsWith("|") && !Orientation.startsWith("-"))
+		{
+			return fail("Splitter with invalid Orientation attribute");
+		}
+
+		bool Ok;
+		int Count = Reader.attributes().value("Count").toInt(&Ok);
+		if (!Ok)
+		{
+			return fail("Splitter without valid Count attribute");
+		}
+
+		int SizeCount = 0;
+		while (Reader.readNextStartElement())
+		{
+			bool Result = true;
+			if (Reader.name() == "Splitter")
+			{
+				Result = parseSplitter(Depth + 1);
+			}
+			else if (Reader.name() == "Area")
+			{
+				Result = parseArea();
+			}
+			else if (Reader.name() == "Sizes")
+			{
+				QString Sizes = Reader.readElementText().trimmed();
+				QTextStream Stream(&Sizes);
+				while (!Stream.atEnd())
+				{
+					int Size;
+					Stream >> Size;
+					if (Stream.status() != QTextStream::Ok)
+					{
+						return fail(QString("Splitter with invalid Sizes \"%1\"").arg(Sizes));
+					}
+					SizeCount++;
+					Statistics.MaxSplitterSize = qMax(Statistics.MaxSplitterSize, Size);
+					Statistics.MinSplitterSize = (Statistics.MinSplitterSize < 0)
+						? Size : qMin(Statistics.MinSplitterSize, Size);
+				}
+			}
+			else
+			{
+				Reader.skipCurrentElement();
+			}
+
+			if (!Result)
+			{
+				return false;
+			}
+		}
+
+		if (SizeCount != Count)
+		{
+			return fail(QString("Splitter with %1 children has %2 sizes").arg(Count).arg(SizeCount));
+		}
+		return true;
+	}
+
+	bool parseContainer()
+	{
+		Statistics.ContainerCount++;
+		if (Reader.attributes().value("Floating").toInt())
+		{
+			Statistics.FloatingContainerCount++;
+		}
+
+		while (Reader.readNextStartElement())
+		{
+			if (Reader.name() == "Splitter")
+			{
+				if (!parseSplitter(1))
+				{
+					return false;
+				}
+			}
+			else if (Reader.name() == "Area")
+			{
+				if (!parseArea())
+				{
+					return false;
+				}
+			}
+			else
+			{
+				Reader.skipCurrentElement();
+			}
+		}
+		return true;
+	}
+
+public:
+	CStateParser(const QByteArray& Xml, CLayoutStatistics& Statistics)
+		: Reader(Xml), Statistics(Statistics)
+	{
+	}
+
+	bool parse()
+	{
+		Reader.readNextStartElement();
+		if (Reader.name() != "QtAdvancedDockingSystem")
+		{
+			return fail("Missing QtAdvancedDockingSystem element");
+		}
+
+		bool Ok;
+		Statistics.FileVersion = Reader.attributes().value("Version").toInt(&Ok);
+		if (!Ok)
+		{
+			return fail("Missing Version attribute");
+		}
+		Reader.setFileVersion(Statistics.FileVersion);
+
+		while (Reader.readNextStartElement())
+		{
+			if (Reader.name() == "Container")
+			{
+				if (!parseContainer())
+				{
+					return false;
+				}
+			}
+			else
+			{
+				Reader.skipCurrentElement();
+			}
+		}
+
+		if (Reader.hasError())
+		{
+			return fail(Reader.errorString());
+		}
+		return true;
+	}
+};
+
+
+/**
+ * Offscreen dock manager with one dock widget for each dock widget name
+ * in the layout
+ */
+class CRestoreEnvironment
+{
+private:
+	QMainWindow MainWindow;
+	CDockManager* DockManager;
+
+public:
+	CRestoreEnvironment(const QStringList& DockWidgetNames)
+	{
+		MainWindow.resize(1280, 800);
+		DockManager = new CDockManager(&MainWindow);
+		for (const auto& Name : DockWidgetNames)
+		{
+			if (DockManager->findDockWidget(Name))
+			{
+				continue;
+			}
+			auto DockWidget = new CDockWidget(Name);
+			DockWidget->setWidget(new QLabel(Name));
+			DockManager->addDockWidget(CenterDockWidgetArea, DockWidget);
+		}
+		MainWindow.show();
+	}
+
+	CDockManager* dockManager() const {return DockManager;}
+};
+
+
+//============================================================================
+static CLayoutStatistics layoutStatistics(const CLayout& Layout)
+{
+	CLayoutStatistics Statistics;
+	if (Layout.Encoding == EncodingUnknown)
+	{
+		Statistics.Error = "Unknown encoding - the data is no docking state";
+		return Statistics;
+	}
+
+	CStateParser Parser(Layout.Xml, Statistics);
+	Parser.parse();
+	return Statistics;
+}
+
+
+//============================================================================
+static void printStatistics(const CLayout& Layout, const CLayoutStatistics& Statistics)
+{
+	std::cout << Layout.Name.toStdString() << "\n"
+		<< "  encoding          " << encodingName(Layout.Encoding) << "\n"
+		<< "  encoded bytes     " << Layout.EncodedSize << "\n"
+		<< "  xml bytes         " << Layout.Xml.size() << "\n"
+		<< "  file version      " << Statistics.FileVersion << "\n"
+		<< "  containers        " << Statistics.ContainerCount
+		<< " (floating " << Statistics.FloatingContainerCount << ")\n"
+		<< "  splitters         " << Statistics.SplitterCount << "\n"
+		<< "  splitter depth    " << Statistics.MaxSplitterDepth << "\n"
+		<< "  splitter sizes    " << qMax(0, Statistics.MinSplitterSize)
+		<< " - " << Statistics.MaxSplitterSize << "\n"
+		<< "  dock areas        " << Statistics.AreaCount << "\n"
+		<< "  max tabs per area " << Statistics.MaxTabCount << "\n"
+		<< "  dock widgets      " << Statistics.DockWidgetCount
+		<< " (closed " << Statistics.ClosedDockWidgetCount << ")\n";
+	if (!Statistics.Error.isEmpty())
+	{
+		std::cout << "  error             " << Statistics.Error.toStdString() << "\n";
+	}
+	std::cout << std::endl;
+}
+
+
+//============================================================================
+static int commandStats(const QList<CLayout>& Layouts)
+{
+	int ExitCode = 0;
+	for (const auto& Layout : Layouts)
+	{
+		auto Statistics = layoutStatistics(Layout);
+		printStatistics(Layout, Statistics);
+		ExitCode |= Statistics.Error.isEmpty() ? 0 : 1;
+	}
+	return ExitCode;
+}
+
+
+//============================================================================
+static int commandValidate(const QList<CLayout>& Layouts)
+{
+	int ExitCode = 0;
+	for (const auto& Layout : Layouts)
+	{
+		auto Statistics = layoutStatistics(Layout);
+		QString Error = Statistics.Error;
+		if (Error.isEmpty())
+		{
+			CRestoreEnvironment Environment(Statistics.DockWidgetNames);
+			if (!Environment.dockManager()->restoreState(Layout.Xml))
+			{
+				Error = "CDockManager::restoreState() rejected the state";
+			}
+		}
+
+		std::cout << Layout.Name.toStdString() << ": "
+			<< (Error.isEmpty() ? std::string("valid") : Error.toStdString()) << std::endl;
+		ExitCode |= Error.isEmpty() ? 0 : 1;
+	}
+	return ExitCode;
+}
+
+
+//============================================================================
+static int commandConvert(const QList<CLayout>& Layouts, const QString& EncodingName,
+	const QString& OutputFileName)
+{
+	eStateEncoding Encoding = encodingFromName(EncodingName);
+	if (Encoding == EncodingUnknown)
+	{
+		std::cerr << "Unknown encoding " << EncodingName.toStdString()
+			<< " - use xml, compressed, base64 or hex" << std::endl;
+		return 2;
+	}
+
+	if (Layouts.count() != 1)
+	{
+		std::cerr << "The input contains " << Layouts.count()
+			<< " layouts - select one with --perspective or --key" << std::endl;
+		return 2;
+	}
+
+	const auto& Layout = Layouts.first();
+	if (Layout.Encoding == EncodingUnknown)
+	{
+		std::cerr << "Unknown input encoding" << std::endl;
+		return 1;
+	}
+
+	QByteArray Output = encodeState(Layout.Xml, Encoding);
+	if (OutputFileName.isEmpty())
+	{
+		std::cout.write(Output.constData(), Output.size());
+		return 0;
+	}
+
+	QFile File(OutputFileName);
+	if (!File.open(QIODevice::WriteOnly | QIODevice::Truncate) || File.write(Output) < 0)
+	{
+		std::cerr << "Can not write " << OutputFileName.toStdString() << std::endl;
+		return 1;
+	}
+	return 0;
+}
+
+
+//============================================================================
+static int commandTime(const QList<CLayout>& Layouts, int Iterations)
+{
+	int ExitCode = 0;
+	for (const auto& Layout : Layouts)
+	{
+		auto Statistics = layoutStatistics(Layout);
+		if (!Statistics.Error.isEmpty())
+		{
+			std::cout << Layout.Name.toStdString() << ": " << Statistics.Error.toStdString() << std::endl;
+			ExitCode = 1;
+			continue;
+		}
+
+		QElapsedTimer Timer;
+		Timer.start();
+		for (int i = 0; i < Iterations; ++i)
+		{
+			CLayoutStatistics Parsed;
+			CStateParser Parser(Layout.Xml, Parsed);
+			Parser.parse();
+		}
+		qint64 ParseNsecs = Timer.nsecsElapsed() / Iterations;
+
+		CRestoreEnvironment Environment(Statistics.DockWidgetNames);
+		auto DockManager = Environment.dockManager();
+		Timer.start();
+		bool Restored = DockManager->restoreState(Layout.Xml);
+		qint64 FirstRestoreNsecs = Timer.nsecsElapsed();
+		Timer.start();
+		for (int i = 0; i < Iterations && Restored; ++i)
+		{
+			Restored = DockManager->restoreState(Layout.Xml);
+		}
+		qint64 RestoreNsecs = Timer.nsecsElapsed() / Iterations;
+
+		std::cout << Layout.Name.toStdString() << "\n"
+			<< "  parse             " << ParseNsecs / 1000.0 << " us\n"
+			<< "  first restore     " << FirstRestoreNsecs / 1000.0 << " us\n"
+			<< "  restore           " << RestoreNsecs / 1000.0 << " us\n";
+		if (!Restored)
+		{
+			std::cout << "  error             CDockManager::restoreState() rejected the state\n";
+			ExitCode = 1;
+		}
+		std::cout << std::endl;
+	}
+	return ExitCode;
+}
+
+
+//============================================================================
+int main(int argc, char *argv[])
+{
+	// Restoring the state does not need a display
+	if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+	{
+		qputenv("QT_QPA_PLATFORM", "offscreen");
+	}
+	QApplication App(argc, argv);
+	QCommandLineParser Parser;
+	Parser.setApplicationDescription("Inspects, validates, converts and times saved docking states.\n"
+		"The file is either a state blob (XML, compressed, base64 or hex) or a\n"
+		"QSettings ini file with perspectives saved by CDockManager::savePerspectives().");
+	Parser.addHelpOption();
+	Parser.addPositionalArgument("command", "stats, validate, convert or time");
+	Parser.addPositionalArgument("file", "State blob or QSettings ini file");
+	QCommandLineOption PerspectiveOption("perspective", "Use only the perspective with the given name.", "name");
+	QCommandLineOption KeyOption("key", "Read the state from the given key of the ini file.", "key");
+	QCommandLineOption EncodingOption("to", "Target encoding of convert: xml, compressed, base64 or hex.", "encoding", "xml");
+	QCommandLineOption OutputOption({"o", "output"}, "Output file of convert - default is stdout.", "file");
+	QCommandLineOption IterationsOption("iterations", "Number of timed iterations.", "count", "10");
+	Parser.addOption(PerspectiveOption);
+	Parser.addOption(KeyOption);
+	Parser.addOption(EncodingOption);
+	Parser.addOption(OutputOption);
+	Parser.addOption(IterationsOption);
+	Parser.process(App);
+
+	const QStringList Arguments = Parser.positionalArguments();
+	if (Arguments.count() != 2)
+	{
+		Parser.showHelp(2);
+	}
+
+	QString Error;
+	auto Layouts = readLayouts(Arguments[1], Parser.value(KeyOption),
+		Parser.value(PerspectiveOption), Error);
+	if (!Error.isEmpty())
+	{
+		std::cerr << Error.toStdString() << std::endl;
+		return 1;
+	}
+
+	const QString Command = Arguments[0];
+	if (Command == "stats")
+	{
+		return commandStats(Layouts);
+	}
+	else if (Command == "validate")
+	{
+		return commandValidate(Layouts);
+	}
+	else if (Command == "convert")
+	{
+		return commandConvert(Layouts, Parser.value(EncodingOption), Parser.value(OutputOption));
+	}
+	else if (Command == "time")
+	{
+		return commandTime(Layouts, qMax(1, Parser.value(IterationsOption).toInt()));
+	}
+
+	std::cerr << "Unknown command " << Command.toStdString() << std::endl;
+	Parser.showHelp(2);
+}
+
+//---------------------------------------------------------------------------
+// EOF StateTool.cpp
@@ -0,0 +1,508 @@
+//============================================================================
+/// \file   StressTest.cpp
+/// \author Uwe Kindler
+/// \date   19.10.2026
+/// \brief  Randomized layout mutation stress test for the docking system
+//============================================================================
+
+
+//============================================================================
+//                                   INCLUDES
+//============================================================================
+#include <iostream>
+#include <random>
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QMainWindow>
+#include <QVector>
+
+#include "DockManager.h"
+#include "DockWidget.h"
+#include "DockAreaWidget.h"
+#include "DockContainerWidget.h"
+#include "DockLayoutModel.h"
+#include "FloatingDockContainer.h"
+#include "../demo/SyntheticLayout.h"
+
+using namespace ads;
+
+/**
+ * Gives the stress test access to the protected drop function that is used
+ * by the drag and drop code
+ */
+struct CDropAccess : public CDockContainerWidget
+{
+	using CDockContainerWidget::dropWidget;
+};
+
+
+/**
+ * Latency histogram with logarithmic buckets. Bucket i counts the
+ * operations that took less than 2^i nanoseconds.
+ */
+class CLatencyHistogram
+{
+private:
+	QVector<qint64> Buckets = QVector<qint64>(64, 0);
+	qint64 Count = 0;
+	qint64 MaxNsecs = 0;
+
+public:
+	void record(qint64 Nsecs)
+	{
+		int Bucket = 0;
+		while (Bucket < 63 && (qint64(1) << Bucket) <= Nsecs)
+		{
+			++Bucket;
+		}
+		Buckets[Bucket]++;
+		Count++;
+		MaxNsecs = qMax(MaxNsecs, Nsecs);
+	}
+
+	qint64 count() const {return Count;}
+	qint64 max() const {return MaxNsecs;}
+
+	/**
+	 * Returns the upper bound of the bucket that contains the given
+	 * quantile
+	 */
+	qint64 quantile(double q) const
+	{
+		qint64 Limit = qint64(q * Count);
+		qint64 Sum = 0;
+		for (int i = 0; i < Buckets.count(); ++i)
+		{
+			Sum += Buckets[i];
+			if (Sum > Limit)
+			{
+				return qMin(qint64(1) << i, MaxNsecs);
+			}
+		}
+		return MaxNsecs;
+	}
+};
+
+
+/**
+ * Runs random but valid layout mutations and checks the layout invariants
+ * after each step. The run is reproducible from the seed.
+ */
+class CDockStressTest
+{
+public:
+	enum eOperation
+	{
+		DropIntoArea,
+		DropIntoContainer,
+		DropArea,
+		ToggleView,
+		SetFloating,
+		ReorderDockWidget,
+		CloseOtherAreas,
+		OpenPerspective,
+		SavePerspective,
+		OperationCount
+	};
+
+private:
+	QMainWindow* MainWindow = nullptr;
+	CDockManager* DockManager = nullptr;
+	QList<CDockWidget*> DockWidgets;
+	std::mt19937 Random;
+	CLatencyHistogram Histograms[OperationCount];
+	int InitialWidgetCount = 0;
+
+	static const char* operationName(int Operation)
+	{
+		static const char* Names[OperationCount] = {"dropIntoArea",
+			"dropIntoContainer", "dropArea", "toggleView", "setFloating",
+			"reorderDockWidget", "closeOtherAreas", "openPerspective",
+			"savePerspective"};
+		return Names[Operation];
+	}
+
+	int randomInt(int Count)
+	{
+		return std::uniform_int_distribution<int>(0, Count - 1)(Random);
+	}
+
+	template <class T>
+	T randomItem(const QList<T>& List)
+	{
+		return List.isEmpty() ? nullptr : List.at(randomInt(List.count()));
+	}
+
+	DockWidgetArea randomSide()
+	{
+		static const DockWidgetArea Sides[] = {LeftDockWidgetArea,
+			RightDockWidgetArea, TopDockWidgetArea, BottomDockWidgetArea};
+		return Sides[randomInt(4)];
+	}
+
+	QList<CDockWidget*> openDockWidgets() const
+	{
+		QList<CDockWidget*> Result;
+		for (auto DockWidget : DockWidgets)
+		{
+			if (!DockWidget->isClosed() && DockWidget->dockAreaWidget())
+			{
+				Result.append(DockWidget);
+			}
+		}
+		return Result;
+	}
+
+	QList<CDockAreaWidget*> dockAreas() const
+	{
+		QList<CDockAreaWidget*> Result;
+		for (auto Container : DockManager->dockContainers())
+		{
+			Result += Container->openedDockAreas();
+		}
+		return Result;
+	}
+
+	static void processDeferredDeletes()
+	{
+		QCoreApplication::processEvents();
+		QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+	}
+
+	static void drop(CDockContainerWidget* Container, QWidget* Widget,
+		DockWidgetArea Area, CDockAreaWidget* TargetArea)
+	{
+		(Container->*(&CDropAccess::dropWidget))(Widget, Area, TargetArea);
+	}
+
+	/**
+	 * Executes the given operation. Returns false if the operation is not
+	 * possible in the current layout
+	 */
+	bool execute(int Operation)
+	{
+		switch (Operation)
+		{
+		case DropIntoArea:
+		{
+			auto DockWidget = randomItem(openDockWidgets());
+			auto TargetArea = randomItem(dockAreas());
+			if (!DockWidget || !TargetArea)
+			{
+				return false;
+			}
+			auto SourceArea = DockWidget->dockAreaWidget();
+			if (SourceArea == TargetArea && SourceArea->dockWidgetsCount() < 2)
+			{
+				return false;
+			}
+			auto Area = randomInt(5) ? randomSide() : CenterDockWidgetArea;
+			if (Area == CenterDockWidgetArea && SourceArea == TargetArea)
+			{
+				return false;
+			}
+			drop(TargetArea->dockContainer(), DockWidget, Area, TargetArea);
+			return true;
+		}
+
+		case DropIntoContainer:
+		{
+			auto DockWidget = randomItem(openDockWidgets());
+			auto Container = randomItem(DockManager->dockContainers());
+			if (!DockWidget || !Container || !Container->isVisible())
+			{
+				return false;
+			}
+			drop(Container, DockWidget, randomSide(), nullptr);
+			return true;
+		}
+
+		case DropArea:
+		{
+			auto SourceArea = randomItem(dockAreas());
+			auto TargetArea = randomItem(dockAreas());
+			if (!SourceArea || !TargetArea || SourceArea == TargetArea
+			 || SourceArea->dockContainer() != TargetArea->dockContainer())
+			{
+				return false;
+			}
+			drop(TargetArea->dockContainer(), SourceArea, randomSide(), TargetArea);
+			return true;
+		}
+
+		case ToggleView:
+		{
+			auto DockWidget = randomItem(DockWidgets);
+			DockWidget->toggleView(DockWidget->isClosed());
+			return true;
+		}
+
+		case SetFloating:
+		{
+			auto DockWidget = randomItem(openDockWidgets());
+			if (!DockWidget || DockWidget->isFloating())
+			{
+				return false;
+			}
+			DockWidget->setFloating();
+			return true;
+		}
+
+		case ReorderDockWidget:
+		{
+			auto Area = randomItem(dockAreas());
+			if (!Area || Area->dockWidgetsCount() < 2)
+			{
+				return false;
+			}
+			int Count = Area->dockWidgetsCount();
+			QMetaObject::invokeMethod(Area, "reorderDockWidget",
+				Q_ARG(int, randomInt(Count)), Q_ARG(int, randomInt(Count)));
+			return true;
+		}
+
+		case CloseOtherAreas:
+		{
+			// Closing other areas is rare in real sessions - it is done
+			// seldom to keep enough open dock widgets for the other operations
+			auto Area = randomItem(dockAreas());
+			if (!Area || randomInt(8))
+			{
+				return false;
+			}
+			Area->closeOtherAreas();
+			return true;
+		}
+
+		case OpenPerspective:
+			DockManager->openPerspective(QString("Perspective %1").arg(randomInt(3)));
+			return true;
+
+		case SavePerspective:
+			DockManager->addPerspective(QString("Perspective %1").arg(randomInt(3)));
+			return true;
+
+		default:
+			return false;
+		}
+	}
+
+	/**
+	 * Checks the layout invariants and returns an error message if an
+	 * invariant is violated
+	 */
+	QString checkInvariants() const
+	{
+		auto Containers = DockManager->dockContainers();
+		for (auto DockWidget : DockWidgets)
+		{
+			if (DockWidget->isClosed())
+			{
+				continue;
+			}
+
+			auto Area = DockWidget->dockAreaWidget();
+			if (!Area)
+			{
+				return QString("Open dock widget %1 has no dock area").arg(DockWidget->objectName());
+			}
+			if (!Containers.contains(Area->dockContainer()))
+			{
+				return QString("Dock area of %1 is not in a registered container").arg(DockWidget->objectName());
+			}
+		}
+
+		for (auto Container : Containers)
+		{
+			const auto& Model = Container->layoutModel();
+			if (Model.areaCount() != Container->dockAreaCount())
+			{
+				return QString("Layout model has %1 areas but the container has %2")
+					.arg(Model.areaCount()).arg(Container->dockAreaCount());
+			}
+
+			int DockWidgetCount = 0;
+			for (int i = 0; i < Container->dockAreaCount(); ++i)
+			{
+				auto Area = Container->dockArea(i);
+				DockWidgetCount += Area->dockWidgetsCount();
+				if (Area->isVisible() && !Area->openDockWidgetsCount())
+				{
+					return QString("Visible dock area without open dock widgets");
+				}
+			}
+			if (Model.dockWidgetCount() != DockWidgetCount)
+			{
+				return QString("Layout model has %1 dock widgets but the container has %2")
+					.arg(Model.dockWidgetCount()).arg(DockWidgetCount);
+			}
+		}
+
+		for (auto FloatingWidget : DockManager->floatingWidgets())
+		{
+			if (FloatingWidget->isVisible() && FloatingWidget->dockContainer()->openedDockAreas().isEmpty())
+			{
+				return QString("Visible floating container without open dock areas");
+			}
+		}
+
+		return QString();
+	}
+
+	void printObjectCounts(qint64 Step) const
+	{
+		auto Statistics = DockManager->statistics();
+		int HiddenFloatingWidgets = 0;
+		for (auto FloatingWidget : DockManager->floatingWidgets())
+		{
+			HiddenFloatingWidgets += FloatingWidget->isVisible() ? 0 : 1;
+		}
+		std::cout << "step " << Step
+			<< " widgets " << QApplication::allWidgets().count()
+			<< " floating " << Statistics.FloatingContainerCount
+			<< " (hidden " << HiddenFloatingWidgets << ")"
+			<< " areas " << Statistics.DockAreaCount
+			<< " splitters " << Statistics.SplitterCount
+			<< " depth " << Statistics.MaxSplitterDepth
+			<< std::endl;
+	}
+
+	void printHistograms() const
+	{
+		std::cout << "\noperation            count     p50 us     p90 us     p99 us     max us" << std::endl;
+		for (int i = 0; i < OperationCount; ++i)
+		{
+			const auto& Histogram = Histograms[i];
+			std::cout << QString("%1 %2 %3 %4 %5 %6")
+				.arg(operationName(i), -18)
+				.arg(Histogram.count(), 8)
+				.arg(Histogram.quantile(0.5) / 1000.0, 10, 'f', 1)
+				.arg(Histogram.quantile(0.9) / 1000.0, 10, 'f', 1)
+				.arg(Histogram.quantile(0.99) / 1000.0, 10, 'f', 1)
+				.arg(Histogram.max() / 1000.0, 10, 'f', 1).toStdString() << std::endl;
+		}
+	}
+
+public:
+	CDockStressTest(quint32 Seed)
+		: Random(Seed)
+	{
+	}
+
+	~CDockStressTest()
+	{
+		delete MainWindow;
+	}
+
+	/**
+	 * Creates the dock manager with the given number of dock widgets in the
+	 * synthetic reference layout and the initial perspectives. The random
+	 * operations start from this layout.
+	 */
+	void setup(int WidgetCount)
+	{
+		MainWindow = new QMainWindow();
+		MainWindow->resize(1280, 800);
+		DockManager = new CDockManager(MainWindow);
+		DockManager->setStatisticsEnabled(true);
+		DockWidgets = CSyntheticLayout::createDockWidgets(WidgetCount, "Stress");
+		CSyntheticLayout::build(DockManager, DockWidgets);
+		MainWindow->show();
+		processDeferredDeletes();
+		for (int i = 0; i < 3; ++i)
+		{
+			DockManager->addPerspective(QString("Perspective %1").arg(i));
+		}
+		DockManager->addPerspective("Initial");
+		InitialWidgetCount = QApplication::allWidgets().count();
+	}
+
+	/**
+	 * Runs the given number of random operations. Returns the exit code
+	 * of the application
+	 */
+	int run(qint64 Steps, qint64 ReportInterval)
+	{
+		QElapsedTimer Timer;
+		for (qint64 Step = 0; Step < Steps; ++Step)
+		{
+			int Operation = randomInt(OperationCount);
+			Timer.start();
+			bool Executed = execute(Operation);
+			processDeferredDeletes();
+			if (!Executed)
+			{
+				continue;
+			}
+			Histograms[Operation].record(Timer.nsecsElapsed());
+
+			QString Error = checkInvariants();
+			if (!Error.isEmpty())
+			{
+				std::cerr << "Invariant violated after step " << Step << " ("
+					<< operationName(Operation) << "): " << Error.toStdString() << std::endl;
+				printHistograms();
+				return 1;
+			}
+
+			if (ReportInterval > 0 && !(Step % ReportInterval))
+			{
+				printObjectCounts(Step);
+			}
+		}
+
+		// If the initial perspective is restored, the number of widgets
+		// should be the same as at the start
+		DockManager->openPerspective("Initial");
+		processDeferredDeletes();
+		printObjectCounts(Steps);
+		printHistograms();
+		int WidgetDelta = QApplication::allWidgets().count() - InitialWidgetCount;
+		std::cout << "\nwidget count delta after restoring the initial perspective: "
+			<< WidgetDelta << std::endl;
+		if (WidgetDelta > 0)
+		{
+			std::cout << "possible leak: " << WidgetDelta << " widgets more than at the start" << std::endl;
+		}
+		return 0;
+	}
+};
+
+
+//============================================================================
+int main(int argc, char *argv[])
+{
+	// The stress test does not need a display
+	if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+	{
+		qputenv("QT_QPA_PLATFORM", "offscreen");
+	}
+	QApplication App(argc, argv);
+	QCommandLineParser Parser;
+	Parser.setApplicationDescription("Randomized layout mutation stress test");
+	Parser.addHelpOption();
+	QCommandLineOption StepsOption("steps", "Number of random operations.", "count", "100000");
+	QCommandLineOption SeedOption("seed", "Seed of the random generator.", "seed");
+	QCommandLineOption WidgetsOption("widgets", "Number of dock widgets.", "count", "24");
+	QCommandLineOption ReportOption("report-interval", "Steps between object count reports.", "steps", "10000");
+	Parser.addOption(StepsOption);
+	Parser.addOption(SeedOption);
+	Parser.addOption(WidgetsOption);
+	Parser.addOption(ReportOption);
+	Parser.process(App);
+
+	quint32 Seed = Parser.isSet(SeedOption) ? Parser.value(SeedOption).toUInt()
+		: quint32(QDateTime::currentMSecsSinceEpoch());
+	std::cout << "seed " << Seed << std::endl;
+
+	CDockStressTest StressTest(Seed);
+	StressTest.setup(qMax(2, Parser.value(WidgetsOption).toInt()));
+	return StressTest.run(Parser.value(StepsOption).toLongLong(),
+		Parser.value(ReportOption).toLongLong());
+}
+
+//---------------------------------------------------------------------------
+// EOF StressTest.cpp